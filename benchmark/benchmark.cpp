@@ -13,18 +13,21 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <format>
 #include <iostream>
 #include <limits>
+#include <new>
 #include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 
-#include "config/b4g_config.h"
-#include "config/pgm_conf.h"
+#include "cli_log.h"
 #include "diagnostic_counter.h"
 #include "nlohmann/json.hpp"
 #include "utils/path.h"
@@ -33,6 +36,7 @@
 #include "utils/resource_location.h"
 #include "utils/unicode_text.h"
 #include "workspace_manager.h"
+#include "workspace_programs.h"
 
 /*
  * The benchmark is used to evaluate multiple aspects about the performance and accuracy of the parse library.
@@ -70,6 +74,9 @@
  * - Continued Statements     - Number of statements that were continued (multiple continuations of one statement count
  *as one continued statement)
  * - Non-continued Statements - Number of statements that were not continued
+ * - Heap Allocations         - Number of heap allocations performed while the file was parsed
+ * - Heap Bytes               - Number of bytes requested from the heap while the file was parsed
+ * - Heap Live Bytes          - Change of the number of bytes allocated on the heap after the file was parsed
  * - Lines                    - Total number of lines
  * - Files                    - Total number of parsed files
  */
@@ -79,29 +86,43 @@ using namespace hlasm_plugin;
 using json = nlohmann::json;
 
 namespace {
-template<typename... Args>
-void log_i(Args... args)
-{
-    (std::clog << ... << args) << '\n';
-}
+std::atomic<size_t> heap_allocations = 0;
+std::atomic<size_t> heap_bytes = 0;
+std::atomic<size_t> heap_live_bytes = 0;
 
-template<typename... Args>
-void log_if(Args... args)
-{
-    (std::clog << ... << args) << std::endl;
-}
+// each allocation is prefixed with its size, so that the live bytes can be tracked
+constexpr size_t heap_header_size = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+} // namespace
 
-template<typename... Args>
-void log_e(Args... args)
+void* operator new(std::size_t size)
 {
-    ((std::clog << "Error: ") << ... << args) << std::endl;
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    heap_bytes.fetch_add(size, std::memory_order_relaxed);
+    heap_live_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto* p = static_cast<char*>(std::malloc(heap_header_size + size)))
+    {
+        std::memcpy(p, &size, sizeof(size));
+        return p + heap_header_size;
+    }
+    throw std::bad_alloc();
 }
-
-template<typename... Args>
-void log_w(Args... args)
+void operator delete(void* p) noexcept
 {
-    ((std::clog << "Warning: ") << ... << args) << std::endl;
+    if (!p)
+        return;
+    auto* block = static_cast<char*>(p) - heap_header_size;
+    std::size_t size;
+    std::memcpy(&size, block, sizeof(size));
+    heap_live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    std::free(block);
 }
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+namespace {
+using cli::log_e;
+using cli::log_i;
+using cli::log_if;
+using cli::log_w;
 
 struct parsing_metadata_collector final : public parser_library::parsing_metadata_consumer
 {
@@ -115,24 +136,23 @@ struct parsing_metadata_collector final : public parser_library::parsing_metadat
     std::vector<parser_library::parsing_metadata> data;
 };
 
-class bench_configuration
+class bench_configuration : public cli::workspace_options
 {
 public:
-    std::string ws_folder = utils::path::current_path().string();
     std::string single_file = "";
     size_t start_range = 0, end_range = 0;
     bool write_details = true;
     bool do_reparse = true;
     std::string message;
     std::vector<std::string> pgm_names;
-    std::optional<std::string> b4g_pgms_dir = std::nullopt;
 
     bool load(int argc, char** argv)
     {
         if (!load_options(argc, argv))
             return false;
 
-        load_programs_to_parse();
+        for (auto& pgm : load_programs())
+            pgm_names.emplace_back(std::move(pgm.name));
         return true;
     }
 
@@ -153,23 +173,12 @@ public:
 private:
     bool load_options(int argc, char** argv)
     {
-        const auto advance_and_retrieve = [argc, &argv](std::string_view option, auto& i, auto& s) {
-            if (i + 1 >= argc)
-            {
-                log_e("Missing parameter for option ", option);
-                return false;
-            }
-
-            s = static_cast<std::string>(argv[++i]);
-            return true;
-        };
-
         for (int i = 1; i < argc; i++)
         {
             if (std::string arg = argv[i]; arg == "-r") // range parameter, format start-end
             {
                 std::string val;
-                if (!advance_and_retrieve(arg, i, val))
+                if (!cli::retrieve_parameter(arg, i, argc, argv, val))
                     return false;
 
                 auto pos = val.find('-');
@@ -190,29 +199,23 @@ private:
                     return false;
                 }
             }
-            else if (arg == "-p") // Path parameter, path to the folder containing .hlasmplugin
+            else if (is_workspace_option(arg)) // Path to the folder containing .hlasmplugin or .bridge.json
             {
-                if (!advance_and_retrieve(arg, i, ws_folder))
+                if (!load_workspace_option(arg, i, argc, argv))
                     return false;
-                ws_folder = utils::path::absolute(ws_folder).string();
             }
             else if (arg == "-c") // Cycle parameter, loop infinitely single file
             {
-                if (!advance_and_retrieve(arg, i, single_file))
+                if (!cli::retrieve_parameter(arg, i, argc, argv, single_file))
                     return false;
             }
             else if (arg == "-d") // Details switch, when specified, details are not outputted to stderr
                 write_details = false;
             else if (arg == "-s") // When specified, skip reparsing each program to test out macro caching
                 do_reparse = false;
-            else if (arg == "-g") // Points to directory containing .bridge.json file
-            {
-                if (!advance_and_retrieve(arg, i, b4g_pgms_dir))
-                    return false;
-            }
             else if (arg == "-m") // Specifies annotation of each "Parsing <file>" message
             {
-                if (!advance_and_retrieve(arg, i, message))
+                if (!cli::retrieve_parameter(arg, i, argc, argv, message))
                     return false;
             }
             else
@@ -224,55 +227,6 @@ private:
 
         return true;
     }
-
-    void load_programs_to_parse()
-    {
-        bool some_config_exists = false;
-
-        if (parser_library::config::pgm_conf pgm_conf; retrieve_config(pgm_conf, ".hlasmplugin/pgm_conf.json"))
-        {
-            some_config_exists = true;
-            for (const auto& pgm : pgm_conf.pgms)
-                pgm_names.emplace_back(pgm.program);
-        }
-
-        if (parser_library::config::b4g_map b4g_conf;
-            b4g_pgms_dir.has_value() && retrieve_config(b4g_conf, b4g_pgms_dir.value() + "/.bridge.json"))
-        {
-            some_config_exists = true;
-            for (const auto& [file, _] : b4g_conf.files)
-                pgm_names.emplace_back(b4g_pgms_dir.value() + "/" + file);
-        }
-
-        if (!some_config_exists)
-        {
-            log_e("Non-existing configuration file: .hlasmplugin/pgm_conf.json");
-
-            if (b4g_pgms_dir.has_value())
-                log_e("Non-existing configuration file: ", b4g_pgms_dir.value(), "/.bridge.json");
-        }
-    }
-
-    template<typename T>
-    bool retrieve_config(T& configuration, std::string_view relative_cfg_file_path)
-    {
-        const auto cfg_json_path = (ws_folder + "/").append(relative_cfg_file_path);
-        auto cfg_o = utils::platform::read_file(cfg_json_path);
-
-        if (!cfg_o.has_value())
-            return false;
-
-        try
-        {
-            json::parse(cfg_o.value(), nullptr, true, true).get_to(configuration);
-        }
-        catch (...)
-        {
-            return false;
-        }
-
-        return true;
-    }
 };
 
 class bench
@@ -377,6 +331,9 @@ private:
     {
         clock_t clock_time;
         long long time;
+        size_t allocations;
+        size_t allocated_bytes;
+        long long live_bytes;
     };
 
     struct parse_results
@@ -475,6 +432,9 @@ private:
             log_i("Continued Statements: ", first_parse_metrics.continued_statements);
             log_i("Non-continued Statements: ", first_parse_metrics.non_continued_statements);
             log_i("Lines: ", first_parse_metrics.lines);
+            log_i("Heap Allocations: ", json_res.value("Heap Allocations", size_t {}));
+            log_i("Heap Bytes: ", json_res.value("Heap Bytes", size_t {}));
+            log_i("Heap Live Bytes: ", json_res.value("Heap Live Bytes", 0LL));
             log_i("Executed Statement/ms: ", (double)exec_statements / (double)parse_time);
             log_i("Line/ms: ", (double)first_parse_metrics.lines / (double)parse_time);
             log_i("Files: ", first_ws_info.files_processed);
@@ -513,7 +473,7 @@ private:
             };
         }
 
-        auto& [clock_time, time] = *time_stats;
+        auto& [clock_time, time, allocations, allocated_bytes, live_bytes] = *time_stats;
         const auto& diag_counter = parse_params.diag_counter;
         const auto& metadata = parse_params.collector.data.front();
 
@@ -550,6 +510,9 @@ private:
                 { "Non-continued Statements", metrics.non_continued_statements },
                 { "Lines", metrics.lines },
                 { "Files", files_processed },
+                { "Heap Allocations", allocations },
+                { "Heap Bytes", allocated_bytes },
+                { "Heap Live Bytes", live_bytes },
             }),
             time,
         };
@@ -576,7 +539,7 @@ private:
             };
         }
 
-        auto& [clock_time, time] = *time_stats;
+        auto& [clock_time, time, allocations, allocated_bytes, live_bytes] = *time_stats;
         return parse_results {
             true,
             json({
@@ -584,6 +547,9 @@ private:
                 { "Reparse CPU Time (ms/n)", 1000.0 * clock_time / CLOCKS_PER_SEC },
                 { "Reparse errors", diag_counter.error_count },
                 { "Reparse warnings", diag_counter.warning_count },
+                { "Reparse Heap Allocations", allocations },
+                { "Reparse Heap Bytes", allocated_bytes },
+                { "Reparse Heap Live Bytes", live_bytes },
             }),
             time,
         };
@@ -601,6 +567,9 @@ private:
         log_if(annotation, "file: ", parse_params.source_file);
 
         // ******************    START THE CLOCK    ******************
+        const auto allocations_start = heap_allocations.load(std::memory_order_relaxed);
+        const auto bytes_start = heap_bytes.load(std::memory_order_relaxed);
+        const auto live_bytes_start = heap_live_bytes.load(std::memory_order_relaxed);
         auto c_start = std::clock();
         auto start = std::chrono::high_resolution_clock::now();
 
@@ -629,6 +598,9 @@ private:
             std::clock() - c_start,
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start)
                 .count(),
+            heap_allocations.load(std::memory_order_relaxed) - allocations_start,
+            heap_bytes.load(std::memory_order_relaxed) - bytes_start,
+            (long long)heap_live_bytes.load(std::memory_order_relaxed) - (long long)live_bytes_start,
         };
     }
 };
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "diagnostic_adder.h"
+#include "expressions/conditional_assembly/terms/ca_function.h"
+
+/*
+ * Microbenchmark of the string conversion built-in functions of the conditional assembly.
+ * Every function is called repeatedly with a typical argument and the average duration of a call is printed.
+ *
+ * Accepted parameters:
+ * -n count      - Number of calls of each function (default 1000000)
+ * -f name       - Runs only the specified function
+ */
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::expressions;
+
+namespace {
+
+struct ca_function_case
+{
+    std::string_view name;
+    std::function<context::SET_t(diagnostic_adder&)> call;
+};
+
+// arguments resemble the strings processed by macro libraries
+const std::string text = "PARM1=VALUE,PARM2='QUOTED && TEXT',PARM3=(A,B,C),LABEL   DS    0H";
+const std::string hex = "C1C2C3C4F1F2F3F47D507D50C1C2C3C4F1F2F3F47D507D50";
+const std::string bin = "110000011100001011000011110001001111000111110010";
+const std::string find_chars = "()";
+const std::string index_text = "DS";
+const std::string hex_word = hex.substr(0, 8);
+
+const ca_function_case cases[] = {
+    { "A2B", [](diagnostic_adder&) { return ca_function::A2B(-123456); } },
+    { "A2X", [](diagnostic_adder&) { return ca_function::A2X(-123456); } },
+    { "B2C", [](diagnostic_adder& d) { return ca_function::B2C(bin, d); } },
+    { "B2X", [](diagnostic_adder& d) { return ca_function::B2X(bin, d); } },
+    { "C2B", [](diagnostic_adder& d) { return ca_function::C2B(text, d); } },
+    { "C2X", [](diagnostic_adder& d) { return ca_function::C2X(text, d); } },
+    { "DCLEN", [](diagnostic_adder&) { return ca_function::DCLEN(text); } },
+    { "DCVAL", [](diagnostic_adder&) { return ca_function::DCVAL(text); } },
+    { "DEQUOTE", [](diagnostic_adder&) { return ca_function::DEQUOTE(text); } },
+    { "DOUBLE", [](diagnostic_adder& d) { return ca_function::DOUBLE(text, d); } },
+    { "FIND", [](diagnostic_adder&) { return ca_function::FIND(text, find_chars); } },
+    { "INDEX", [](diagnostic_adder&) { return ca_function::INDEX(text, index_text); } },
+    { "ISHEX", [](diagnostic_adder& d) { return ca_function::ISHEX(hex_word, d); } },
+    { "LOWER", [](diagnostic_adder&) { return ca_function::LOWER(text); } },
+    { "UPPER", [](diagnostic_adder&) { return ca_function::UPPER(text); } },
+    { "X2B", [](diagnostic_adder& d) { return ca_function::X2B(hex, d); } },
+    { "X2C", [](diagnostic_adder& d) { return ca_function::X2C(hex, d); } },
+};
+
+// prevents the calls from being optimized away
+size_t consume(const context::SET_t& v)
+{
+    switch (v.type())
+    {
+        case context::SET_t_enum::A_TYPE:
+            return v.access_a();
+        case context::SET_t_enum::B_TYPE:
+            return v.access_b();
+        case context::SET_t_enum::C_TYPE:
+            return v.access_c().size();
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t count = 1000000;
+    std::string_view only;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            count = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "-f" && i + 1 < argc)
+            only = argv[++i];
+        else
+        {
+            std::cerr << "Unknown parameter: " << arg << '\n';
+            return 1;
+        }
+    }
+
+    size_t checksum = 0;
+    for (const auto& [name, call] : cases)
+    {
+        if (!only.empty() && only != name)
+            continue;
+
+        diagnostic_adder add_diagnostic;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+            checksum += consume(call(add_diagnostic));
+        const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("{:<8} {:>10.1f} ns/call{}\n",
+            name,
+            count ? duration.count() / count : 0.,
+            add_diagnostic.diagnostics_present ? " (diagnostics reported)" : "");
+    }
+
+    std::cout << "Checksum: " << checksum << '\n';
+
+    return 0;
+}
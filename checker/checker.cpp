@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "checker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <exception>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "cli_log.h"
+#include "diagnostic.h"
+#include "nlohmann/json.hpp"
+#include "utils/path.h"
+#include "utils/path_conversions.h"
+#include "utils/platform.h"
+#include "utils/unicode_text.h"
+#include "workspace_manager.h"
+#include "workspace_programs.h"
+
+/*
+ * The checker analyzes all programs of a workspace without an editor, e.g. in CI pipelines.
+ * The programs are taken from the workspace's pgm_conf.json or .bridge.json and they are distributed
+ * among worker threads. Each worker owns a workspace manager, so the configuration and the library
+ * listings are loaded only once per worker, and the programs it checks share the parsed macros and
+ * copy members. Programs of the same processor group are handed out together to make the most of it.
+ * Diagnostics of all programs are written as a single json or SARIF document, diagnostics reported
+ * for a shared file (e.g. a macro) by several programs are written only once.
+ *
+ * Accepted parameters:
+ * -p path    - Specifies a path to the folder with .hlasmplugin, the current directory by default
+ * -g path    - Specifies a path to the folder with .bridge.json
+ * -j threads - Number of programs analyzed concurrently, the number of hardware threads by default
+ * -f format  - Output format, json (default) or sarif
+ * -o file    - Writes the output into the file instead of the standard output
+ *
+ * Exit codes:
+ * 0 - No errors were reported
+ * 1 - At least one error was reported or a program could not be analyzed
+ * 2 - Invalid parameters or no programs to analyze
+ */
+
+namespace hlasm_plugin::checker {
+
+using json = nlohmann::json;
+
+namespace {
+using cli::log_e;
+
+enum class output_format
+{
+    json,
+    sarif,
+};
+
+class check_configuration : public cli::workspace_options
+{
+public:
+    unsigned threads = std::max(1U, std::thread::hardware_concurrency());
+    output_format format = output_format::json;
+    std::optional<std::string> output_file;
+    std::vector<cli::workspace_program> programs;
+
+    bool load(int argc, char** argv)
+    {
+        if (!load_options(argc, argv))
+            return false;
+
+        programs = load_programs();
+        // programs of the same group use the same libraries
+        std::ranges::stable_sort(programs, {}, &cli::workspace_program::pgroup);
+        return true;
+    }
+
+private:
+    bool load_options(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string val;
+            if (std::string_view arg = argv[i]; is_workspace_option(arg))
+            {
+                if (!load_workspace_option(arg, i, argc, argv))
+                    return false;
+            }
+            else if (arg == "-j")
+            {
+                if (!cli::retrieve_parameter(arg, i, argc, argv, val))
+                    return false;
+                const auto [p, err] = std::from_chars(val.data(), val.data() + val.size(), threads);
+                if (err != std::errc() || p != val.data() + val.size() || threads == 0)
+                {
+                    log_e("Number of threads must be a positive integer");
+                    return false;
+                }
+            }
+            else if (arg == "-f")
+            {
+                if (!cli::retrieve_parameter(arg, i, argc, argv, val))
+                    return false;
+                if (val == "json")
+                    format = output_format::json;
+                else if (val == "sarif")
+                    format = output_format::sarif;
+                else
+                {
+                    log_e("Unknown output format ", val);
+                    return false;
+                }
+            }
+            else if (arg == "-o")
+            {
+                if (!cli::retrieve_parameter(arg, i, argc, argv, val))
+                    return false;
+                output_file = std::move(val);
+            }
+            else
+            {
+                log_e("Unknown parameter ", arg);
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+// keeps the diagnostics of all opened files, i.e. of the single program being checked and its dependencies
+struct diagnostics_snapshot final : public parser_library::diagnostics_consumer
+{
+    void consume_diagnostics(std::span<const parser_library::diagnostic> diagnostics,
+        std::span<const parser_library::fade_message>) override
+    {
+        diags.assign(diagnostics.begin(), diagnostics.end());
+    }
+
+    std::vector<parser_library::diagnostic> diags;
+};
+
+struct program_result
+{
+    std::string failure;
+    std::vector<parser_library::diagnostic> diags;
+};
+
+void check_program(parser_library::workspace_manager& ws,
+    diagnostics_snapshot& snapshot,
+    const std::string& ws_folder,
+    const std::string& program,
+    program_result& result)
+{
+    const auto source_path = utils::path::join(ws_folder, program).string();
+
+    const auto content = utils::platform::read_file(source_path);
+    if (!content.has_value())
+    {
+        result.failure = "Read error";
+        return;
+    }
+
+    const auto source_uri = utils::path::path_to_uri(source_path);
+    try
+    {
+        ws.did_open_file(source_uri, 1, utils::replace_non_utf8_chars(*content));
+        ws.idle_handler();
+
+        result.diags = std::move(snapshot.diags);
+
+        ws.did_close_file(source_uri);
+        ws.idle_handler();
+    }
+    catch (const std::exception& e)
+    {
+        result.failure = e.what();
+    }
+    catch (...)
+    {
+        result.failure = "Analysis failed";
+    }
+}
+
+// programs are handed out in chunks of consecutive programs
+void check_programs(
+    const check_configuration& cfg, std::vector<program_result>& results, std::atomic<size_t>& next, size_t chunk)
+{
+    diagnostics_snapshot snapshot;
+    auto ws = parser_library::create_workspace_manager({ .share_member_caches = true });
+    ws->register_diagnostics_consumer(&snapshot);
+    ws->add_workspace(cfg.ws_folder, utils::path::path_to_uri(cfg.ws_folder));
+    ws->idle_handler();
+
+    const auto count = cfg.programs.size();
+    for (size_t first; (first = next.fetch_add(chunk, std::memory_order_relaxed)) < count;)
+    {
+        for (size_t i = first; i < std::min(first + chunk, count); ++i)
+            check_program(*ws, snapshot, cfg.ws_folder, cfg.programs[i].name, results[i]);
+    }
+}
+
+std::string_view severity_name(parser_library::diagnostic_severity s)
+{
+    switch (s)
+    {
+        using enum parser_library::diagnostic_severity;
+        case error:
+            return "error";
+        case warning:
+            return "warning";
+        case info:
+            return "info";
+        case hint:
+            return "hint";
+        default:
+            return "unspecified";
+    }
+}
+
+std::string_view sarif_level(parser_library::diagnostic_severity s)
+{
+    switch (s)
+    {
+        using enum parser_library::diagnostic_severity;
+        case error:
+            return "error";
+        case warning:
+            return "warning";
+        default:
+            return "note";
+    }
+}
+
+json range_json(const parser_library::range& r)
+{
+    return json {
+        { "start", { { "line", r.start.line }, { "character", r.start.column } } },
+        { "end", { { "line", r.end.line }, { "character", r.end.column } } },
+    };
+}
+
+json to_json(const check_configuration& cfg,
+    const std::vector<program_result>& results,
+    const std::vector<const parser_library::diagnostic*>& diags)
+{
+    json programs = json::array();
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        if (!r.failure.empty())
+        {
+            programs.push_back({ { "program", cfg.programs[i].name }, { "success", false }, { "reason", r.failure } });
+            continue;
+        }
+        const auto count = [&r](parser_library::diagnostic_severity s) {
+            return std::ranges::count(r.diags, s, &parser_library::diagnostic::severity);
+        };
+        programs.push_back({
+            { "program", cfg.programs[i].name },
+            { "success", true },
+            { "errors", count(parser_library::diagnostic_severity::error) },
+            { "warnings", count(parser_library::diagnostic_severity::warning) },
+        });
+    }
+
+    json diagnostics = json::array();
+    for (const auto* d : diags)
+        diagnostics.push_back({
+            { "uri", d->file_uri },
+            { "range", range_json(d->diag_range) },
+            { "severity", severity_name(d->severity) },
+            { "code", d->code },
+            { "message", d->message },
+        });
+
+    return json {
+        { "programs", std::move(programs) },
+        { "diagnostics", std::move(diagnostics) },
+    };
+}
+
+json to_sarif(const std::vector<const parser_library::diagnostic*>& diags)
+{
+    json results = json::array();
+    for (const auto* d : diags)
+    {
+        const auto& r = d->diag_range;
+        results.push_back({
+            { "ruleId", d->code },
+            { "level", sarif_level(d->severity) },
+            { "message", { { "text", d->message } } },
+            { "locations",
+                json::array({
+                    { { "physicalLocation",
+                        {
+                            { "artifactLocation", { { "uri", d->file_uri } } },
+                            { "region",
+                                {
+                                    { "startLine", r.start.line + 1 },
+                                    { "startColumn", r.start.column + 1 },
+                                    { "endLine", r.end.line + 1 },
+                                    { "endColumn", r.end.column + 1 },
+                                } },
+                        } } },
+                }) },
+        });
+    }
+
+    return json {
+        { "$schema", "https://json.schemastore.org/sarif-2.1.0.json" },
+        { "version", "2.1.0" },
+        { "runs",
+            json::array({
+                {
+                    { "tool", { { "driver", { { "name", "hlasm_checker" } } } } },
+                    { "results", std::move(results) },
+                },
+            }) },
+    };
+}
+} // namespace
+
+int run(int argc, char** argv, std::ostream& out)
+{
+    check_configuration cfg;
+    if (!cfg.load(argc, argv))
+        return 2;
+
+    if (cfg.programs.empty())
+    {
+        log_e("No programs to check");
+        return 2;
+    }
+
+    std::vector<program_result> results(cfg.programs.size());
+    std::atomic<size_t> next = 0;
+
+    std::vector<std::thread> workers;
+    const auto thread_count = std::min<size_t>(cfg.threads, cfg.programs.size());
+    // several chunks per worker to balance the load
+    const auto chunk = std::max<size_t>(1, cfg.programs.size() / (4 * thread_count));
+    workers.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+        workers.emplace_back(check_programs, std::cref(cfg), std::ref(results), std::ref(next), chunk);
+    for (auto& w : workers)
+        w.join();
+
+    constexpr auto key = [](const parser_library::diagnostic* d) {
+        const auto& r = d->diag_range;
+        return std::tie(d->file_uri, r.start, r.end, d->code, d->message);
+    };
+    std::vector<const parser_library::diagnostic*> diags;
+    for (const auto& r : results)
+        for (const auto& d : r.diags)
+            diags.push_back(&d);
+    std::ranges::sort(diags, {}, key);
+    diags.erase(std::ranges::unique(diags, {}, key).begin(), diags.end());
+
+    bool failed = false;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (results[i].failure.empty())
+            continue;
+        failed = true;
+        log_e(cfg.programs[i].name, ": ", results[i].failure);
+    }
+    failed |= std::ranges::any_of(
+        diags, [](const auto* d) { return d->severity == parser_library::diagnostic_severity::error; });
+
+    const auto output = cfg.format == output_format::sarif ? to_sarif(diags) : to_json(cfg, results, diags);
+
+    if (cfg.output_file.has_value())
+    {
+        std::ofstream file(*cfg.output_file);
+        if (!(file << output.dump(2) << '\n'))
+        {
+            log_e("Unable to write ", *cfg.output_file);
+            return 2;
+        }
+    }
+    else
+        out << output.dump(2) << '\n';
+
+    return failed ? 1 : 0;
+}
+
+} // namespace hlasm_plugin::checker
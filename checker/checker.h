@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_CHECKER_CHECKER_H
+#define HLASMPLUGIN_CHECKER_CHECKER_H
+
+#include <iosfwd>
+
+namespace hlasm_plugin::checker {
+
+// Runs the checker with the command line arguments, the output goes to out unless -o is specified,
+// returns the exit code
+int run(int argc, char** argv, std::ostream& out);
+
+} // namespace hlasm_plugin::checker
+
+#endif
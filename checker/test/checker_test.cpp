@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "checker.h"
+#include "nlohmann/json.hpp"
+
+using namespace hlasm_plugin::checker;
+using json = nlohmann::json;
+
+namespace {
+std::pair<int, std::string> run_checker(std::initializer_list<std::string> args)
+{
+    std::vector<std::string> storage { "hlasm_checker" };
+    storage.insert(storage.end(), args);
+    std::vector<char*> argv;
+    for (auto& a : storage)
+        argv.push_back(a.data());
+
+    std::ostringstream out;
+    const auto rc = run((int)argv.size(), argv.data(), out);
+    return { rc, out.str() };
+}
+
+std::vector<std::string> codes(const json& diagnostics, std::string_view key)
+{
+    std::vector<std::string> result;
+    for (const auto& d : diagnostics)
+        result.push_back(d.at(key).get<std::string>());
+    std::ranges::sort(result);
+    return result;
+}
+} // namespace
+
+TEST(checker, invalid_parameters)
+{
+    EXPECT_EQ(run_checker({ "-x" }).first, 2);
+    EXPECT_EQ(run_checker({ "-p" }).first, 2);
+    EXPECT_EQ(run_checker({ "-p", "test/checker/clean", "-j", "0" }).first, 2);
+    EXPECT_EQ(run_checker({ "-p", "test/checker/clean", "-f", "xml" }).first, 2);
+}
+
+TEST(checker, no_programs)
+{
+    EXPECT_EQ(run_checker({ "-p", "test/checker/does_not_exist" }), (std::pair<int, std::string>(2, "")));
+}
+
+TEST(checker, clean_workspace)
+{
+    const auto [rc, out] = run_checker({ "-p", "test/checker/clean", "-j", "2" });
+
+    EXPECT_EQ(rc, 0);
+
+    const auto result = json::parse(out);
+    EXPECT_EQ(result.at("diagnostics"), json::array());
+
+    std::vector<std::string> programs;
+    for (const auto& p : result.at("programs"))
+    {
+        programs.push_back(p.at("program").get<std::string>());
+        EXPECT_EQ(p.at("success"), true);
+        EXPECT_EQ(p.at("errors"), 0);
+        EXPECT_EQ(p.at("warnings"), 0);
+    }
+    std::ranges::sort(programs);
+    EXPECT_EQ(programs, (std::vector<std::string> { "src/FIRST", "src/SECOND" }));
+}
+
+TEST(checker, errors_json)
+{
+    const auto [rc, out] = run_checker({ "-p", "test/checker/errors", "-j", "1" });
+
+    EXPECT_EQ(rc, 1);
+
+    const auto result = json::parse(out);
+    const auto& programs = result.at("programs");
+    ASSERT_EQ(programs.size(), 3);
+
+    EXPECT_EQ(programs[0].at("program"), "src/FIRST");
+    EXPECT_EQ(programs[0].at("success"), true);
+    EXPECT_EQ(programs[0].at("errors"), 1);
+    EXPECT_EQ(programs[1].at("program"), "src/SECOND");
+    EXPECT_EQ(programs[1].at("success"), true);
+    EXPECT_EQ(programs[1].at("errors"), 2);
+    EXPECT_EQ(programs[2].at("program"), "src/MISSING");
+    EXPECT_EQ(programs[2].at("success"), false);
+    EXPECT_EQ(programs[2].at("reason"), "Read error");
+
+    // the error in the macro is reported by both programs, but it is written once
+    const auto& diagnostics = result.at("diagnostics");
+    const auto macro_diags = std::ranges::count_if(
+        diagnostics, [](const auto& d) { return d.at("uri").template get<std::string>().ends_with("/lib/MAC"); });
+    EXPECT_EQ(macro_diags, 1);
+    EXPECT_EQ(codes(diagnostics, "code"), (std::vector<std::string> { "E049", "M000" }));
+    EXPECT_EQ(codes(diagnostics, "severity"), (std::vector<std::string> { "error", "error" }));
+
+    for (const auto& d : diagnostics)
+    {
+        EXPECT_TRUE(d.contains("range"));
+        EXPECT_TRUE(d.contains("code"));
+        EXPECT_TRUE(d.contains("message"));
+    }
+}
+
+TEST(checker, errors_sarif)
+{
+    const auto output = std::filesystem::temp_directory_path() / "hlasm_checker_errors_sarif.json";
+    std::filesystem::remove(output);
+
+    const auto [rc, out] = run_checker({ "-p", "test/checker/errors", "-f", "sarif", "-o", output.string() });
+
+    EXPECT_EQ(rc, 1);
+    EXPECT_EQ(out, "");
+
+    std::ifstream in(output);
+    const auto result = json::parse(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+    in.close();
+    std::filesystem::remove(output);
+
+    EXPECT_EQ(result.at("version"), "2.1.0");
+    const auto& run = result.at("runs").at(0);
+    EXPECT_EQ(run.at("tool").at("driver").at("name"), "hlasm_checker");
+
+    const auto& results = run.at("results");
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(codes(results, "ruleId"), (std::vector<std::string> { "E049", "M000" }));
+    EXPECT_EQ(codes(results, "level"), (std::vector<std::string> { "error", "error" }));
+
+    for (const auto& r : results)
+    {
+        const auto& location = r.at("locations").at(0).at("physicalLocation");
+        // regions are one based
+        EXPECT_GE(location.at("region").at("startLine").get<size_t>(), 1);
+        EXPECT_GE(location.at("region").at("startColumn").get<size_t>(), 1);
+        EXPECT_TRUE(r.at("message").contains("text"));
+    }
+}
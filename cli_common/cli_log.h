@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_CLI_COMMON_CLI_LOG_H
+#define HLASMPLUGIN_CLI_COMMON_CLI_LOG_H
+
+#include <iostream>
+
+namespace hlasm_plugin::cli {
+
+template<typename... Args>
+void log_i(Args... args)
+{
+    (std::clog << ... << args) << '\n';
+}
+
+template<typename... Args>
+void log_if(Args... args)
+{
+    (std::clog << ... << args) << std::endl;
+}
+
+template<typename... Args>
+void log_e(Args... args)
+{
+    ((std::clog << "Error: ") << ... << args) << std::endl;
+}
+
+template<typename... Args>
+void log_w(Args... args)
+{
+    ((std::clog << "Warning: ") << ... << args) << std::endl;
+}
+
+} // namespace hlasm_plugin::cli
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "workspace_programs.h"
+
+#include <filesystem>
+#include <regex>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+
+#include "cli_log.h"
+#include "config/b4g_config.h"
+#include "config/pgm_conf.h"
+#include "nlohmann/json.hpp"
+#include "utils/path.h"
+#include "utils/platform.h"
+#include "workspaces/wildcard.h"
+
+namespace hlasm_plugin::cli {
+
+namespace {
+template<typename T>
+bool retrieve_config(T& configuration, const std::string& ws_folder, std::string_view relative_cfg_file_path)
+{
+    const auto cfg_o = utils::platform::read_file((ws_folder + "/").append(relative_cfg_file_path));
+    if (!cfg_o.has_value())
+        return false;
+
+    try
+    {
+        nlohmann::json::parse(cfg_o.value(), nullptr, true, true).get_to(configuration);
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void expand_wildcard(std::vector<workspace_program>& programs,
+    const std::string& ws_folder,
+    const parser_library::config::program_mapping& pgm)
+{
+    const auto regex = parser_library::workspaces::wildcard2regex(pgm.program);
+
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(ws_folder, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (!it->is_regular_file(ec))
+            continue;
+
+        if (auto relative = it->path().lexically_relative(ws_folder).generic_string();
+            std::regex_match(relative, regex))
+            programs.push_back({ std::move(relative), pgm.pgroup });
+    }
+}
+} // namespace
+
+bool retrieve_parameter(std::string_view option, int& i, int argc, char** argv, std::string& value)
+{
+    if (i + 1 >= argc)
+    {
+        log_e("Missing parameter for option ", option);
+        return false;
+    }
+
+    value = argv[++i];
+    return true;
+}
+
+workspace_options::workspace_options()
+    : ws_folder(utils::path::current_path().string())
+{}
+
+bool workspace_options::is_workspace_option(std::string_view arg) noexcept { return arg == "-p" || arg == "-g"; }
+
+bool workspace_options::load_workspace_option(std::string_view arg, int& i, int argc, char** argv)
+{
+    std::string val;
+    if (!retrieve_parameter(arg, i, argc, argv, val))
+        return false;
+
+    if (arg == "-p")
+        ws_folder = utils::path::absolute(val).string();
+    else
+        b4g_pgms_dir = std::move(val);
+
+    return true;
+}
+
+std::vector<workspace_program> workspace_options::load_programs() const
+{
+    std::vector<workspace_program> programs;
+    bool some_config_exists = false;
+
+    if (parser_library::config::pgm_conf pgm_conf;
+        retrieve_config(pgm_conf, ws_folder, ".hlasmplugin/pgm_conf.json"))
+    {
+        some_config_exists = true;
+        for (const auto& pgm : pgm_conf.pgms)
+        {
+            if (pgm.program.find_first_of("*?") == std::string::npos)
+                programs.push_back({ pgm.program, pgm.pgroup });
+            else
+                expand_wildcard(programs, ws_folder, pgm);
+        }
+    }
+
+    if (parser_library::config::b4g_map b4g_conf;
+        b4g_pgms_dir.has_value() && retrieve_config(b4g_conf, ws_folder, *b4g_pgms_dir + "/.bridge.json"))
+    {
+        some_config_exists = true;
+        for (const auto& [file, detail] : b4g_conf.files)
+            programs.push_back({
+                *b4g_pgms_dir + "/" + file,
+                detail.processor_group_name.empty() ? b4g_conf.default_processor_group_name
+                                                    : detail.processor_group_name,
+            });
+    }
+
+    if (!some_config_exists)
+    {
+        log_e("Non-existing configuration file: .hlasmplugin/pgm_conf.json");
+
+        if (b4g_pgms_dir.has_value())
+            log_e("Non-existing configuration file: ", *b4g_pgms_dir, "/.bridge.json");
+    }
+
+    // the same program may be matched by several entries, the first one applies
+    std::unordered_set<std::string> seen;
+    std::vector<workspace_program> result;
+    result.reserve(programs.size());
+    for (auto& p : programs)
+        if (seen.insert(p.name).second)
+            result.push_back(std::move(p));
+
+    return result;
+}
+
+} // namespace hlasm_plugin::cli
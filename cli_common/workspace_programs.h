@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_CLI_COMMON_WORKSPACE_PROGRAMS_H
+#define HLASMPLUGIN_CLI_COMMON_WORKSPACE_PROGRAMS_H
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hlasm_plugin::cli {
+
+struct workspace_program
+{
+    // relative to the workspace folder, unless it comes from .bridge.json
+    std::string name;
+    std::string pgroup;
+};
+
+// Retrieves the parameter of the option at position i of the command line
+bool retrieve_parameter(std::string_view option, int& i, int argc, char** argv, std::string& value);
+
+// Options selecting the workspace and its programs, shared by the command line tools
+class workspace_options
+{
+public:
+    // path to the folder with .hlasmplugin
+    std::string ws_folder;
+    // path to the folder with .bridge.json
+    std::optional<std::string> b4g_pgms_dir;
+
+    workspace_options();
+
+    // -p path and -g path
+    static bool is_workspace_option(std::string_view arg) noexcept;
+    bool load_workspace_option(std::string_view arg, int& i, int argc, char** argv);
+
+    // programs from pgm_conf.json and .bridge.json in the order of the configuration files,
+    // wildcards are matched against the files in the workspace folder, each program is listed once
+    std::vector<workspace_program> load_programs() const;
+};
+
+} // namespace hlasm_plugin::cli
+
+#endif
@@ -24,7 +24,12 @@ type OutputLine = {
     level: number;
     text: string;
 };
-type OutputResult = OutputLine[];
+type OutputResult = {
+    lines: OutputLine[];
+    generation: number;
+};
+
+const outputPageSize = 10000;
 
 type Options = { mnote: true, punch: true } | { mnote: false, punch: true } | { mnote: true, punch: false };
 
@@ -85,11 +90,29 @@ export function registerOutputDocumentContentProvider(
         async provideTextDocumentContent(uri: vscode.Uri, token: vscode.CancellationToken) {
             const opts = extractOptions(uri);
             const fileUri = uriFriendlyBase16Decode(uri.query);
-            const outputs = await channel.sendRequest<OutputResult>('textDocument/$/retrieve_outputs', { textDocument: { uri: fileUri } }, token).catch(e => {
-                vscode.window.showErrorMessage('Error encountered while fetching output document: ' + e);
-                return [] as OutputResult;
-            });
-            return outputs.filter(x => opts.mnote && x.level >= 0 || opts.punch && x.level < 0).map(outputLineToString).join('\n');
+            let lines: string[] = [];
+            let generation = 0;
+            let first = 0;
+            while (!token.isCancellationRequested) {
+                const page = await channel.sendRequest<OutputResult>('textDocument/$/retrieve_outputs', { textDocument: { uri: fileUri }, first, count: outputPageSize }, token).catch(e => {
+                    vscode.window.showErrorMessage('Error encountered while fetching output document: ' + e);
+                    return undefined;
+                });
+                if (!page)
+                    break;
+                if (first > 0 && page.generation !== generation) {
+                    // the output changed while it was being fetched
+                    lines = [];
+                    first = 0;
+                    continue;
+                }
+                generation = page.generation;
+                lines.push(...page.lines.filter(x => opts.mnote && x.level >= 0 || opts.punch && x.level < 0).map(outputLineToString));
+                if (page.lines.length < outputPageSize)
+                    break;
+                first += outputPageSize;
+            }
+            return lines.join('\n');
         },
     });
     const notification = channel.onNotification('$/retrieve_outputs', x => {
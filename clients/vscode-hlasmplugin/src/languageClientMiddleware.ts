@@ -107,6 +107,14 @@ export function getLanguageClientMiddleware(): HlasmPluginMiddleware {
             sendOpenNotification(document.uri.toString());
             return next(document, token);
         },
+        provideDocumentSemanticTokensEdits: (document, previousResultId, token, next) => {
+            sendOpenNotification(document.uri.toString());
+            return next(document, previousResultId, token);
+        },
+        provideDocumentRangeSemanticTokens: (document, range, token, next) => {
+            sendOpenNotification(document.uri.toString());
+            return next(document, range, token);
+        },
         provideDocumentSymbols: (document, token, next) => {
             sendOpenNotification(document.uri.toString());
             return next(document, token);
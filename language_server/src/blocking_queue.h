@@ -16,6 +16,7 @@
 #define HLASMPLUGIN_HLASMLANGUAGESERVER_BLOCKING_QUEUE_H
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -42,6 +43,22 @@ class blocking_queue
     std::deque<T> queue;
     std::atomic<unsigned char> state = 0;
 
+    std::optional<T> pop_locked()
+    {
+        constexpr auto drop = blocking_queue_termination_policy::drop_elements;
+        constexpr auto process = blocking_queue_termination_policy::process_elements;
+
+        if ((termination_policy == drop && terminated()) || (termination_policy == process && queue.size() == 0))
+            return std::nullopt;
+
+        std::optional<T> result = std::move(queue.front());
+        queue.pop_front();
+        if (queue.empty())
+            state.fetch_and(static_cast<unsigned char>(~has_elements_flag), std::memory_order_relaxed);
+
+        return result;
+    }
+
 public:
     bool push(T&& t)
     {
@@ -83,21 +100,20 @@ public:
 
     std::optional<T> pop()
     {
-        constexpr auto drop = blocking_queue_termination_policy::drop_elements;
-        constexpr auto process = blocking_queue_termination_policy::process_elements;
-
         std::unique_lock g(mutex);
         cond_var.wait(g, [this] { return queue.size() || terminated(); });
 
-        if ((termination_policy == drop && terminated()) || (termination_policy == process && queue.size() == 0))
-            return std::nullopt;
+        return pop_locked();
+    }
 
-        std::optional<T> result = std::move(queue.front());
-        queue.pop_front();
-        if (queue.empty())
-            state.fetch_and(static_cast<unsigned char>(~has_elements_flag), std::memory_order_relaxed);
+    // returns the timeout_value when nothing arrives before the deadline
+    std::optional<T> pop_until(std::chrono::steady_clock::time_point deadline, T timeout_value)
+    {
+        std::unique_lock g(mutex);
+        if (!cond_var.wait_until(g, deadline, [this] { return queue.size() || terminated(); }))
+            return timeout_value;
 
-        return result;
+        return pop_locked();
     }
 
     void terminate()
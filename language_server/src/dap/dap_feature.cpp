@@ -160,6 +160,8 @@ void dap_feature::on_initialize(const request_id& requested_seq, const nlohmann:
             { "supportsConfigurationDoneRequest", true },
             { "supportsEvaluateForHovers", true },
             { "supportsFunctionBreakpoints", true },
+            { "supportsConditionalBreakpoints", true },
+            { "supportsHitConditionalBreakpoints", true },
         });
 
     line_1_based_ = args.at("linesStartAt1").get<bool>() ? 1 : 0;
@@ -225,14 +227,23 @@ void dap_feature::on_set_breakpoints(const request_id& request_seq, const nlohma
 
     nlohmann::json breakpoints_verified = nlohmann::json::array();
 
+    const utils::conversion_helper tc(m_text_convertor);
     auto source = server_conformant_path(args.at("source").at("path").get<std::string_view>(), client_path_format_);
     std::vector<parser_library::debugging::breakpoint> breakpoints;
 
+    static constexpr auto optional_string = [](const nlohmann::json& j, const char* key) -> std::string_view {
+        if (auto it = j.find(key); it != j.end() && it->is_string())
+            return it->get<std::string_view>();
+        return {};
+    };
+
     if (auto bpoints_found = args.find("breakpoints"); bpoints_found != args.end())
     {
         for (auto& bp_json : bpoints_found.value())
         {
-            breakpoints.emplace_back(bp_json.at("line").get<nlohmann::json::number_unsigned_t>() - line_1_based_);
+            breakpoints.emplace_back(bp_json.at("line").get<nlohmann::json::number_unsigned_t>() - line_1_based_,
+                tc.convert_from(optional_string(bp_json, "condition")),
+                optional_string(bp_json, "hitCondition"));
             breakpoints_verified.push_back(nlohmann::json { { "verified", true } });
         }
     }
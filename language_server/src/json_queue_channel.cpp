@@ -18,6 +18,11 @@ namespace hlasm_plugin::language_server {
 
 std::optional<nlohmann::json> hlasm_plugin::language_server::json_queue_channel::read() { return queue.pop(); }
 
+std::optional<nlohmann::json> json_queue_channel::read_until(std::chrono::steady_clock::time_point deadline)
+{
+    return queue.pop_until(deadline, nlohmann::json::value_t::discarded);
+}
+
 void json_queue_channel::write(const nlohmann::json& json) { queue.push(json); }
 void json_queue_channel::write(nlohmann::json&& json) { queue.push(std::move(json)); }
 
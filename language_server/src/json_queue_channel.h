@@ -15,6 +15,8 @@
 #ifndef HLASMPLUGIN_HLASMLANGUAGESERVER_JSON_QUEUE_CHANNEL_H
 #define HLASMPLUGIN_HLASMLANGUAGESERVER_JSON_QUEUE_CHANNEL_H
 
+#include <chrono>
+
 #include "json_channel.h"
 
 #include "blocking_queue.h"
@@ -27,6 +29,8 @@ class json_queue_channel final : public json_channel
 
 public:
     std::optional<nlohmann::json> read() override;
+    // returns a discarded value when nothing arrives before the deadline
+    std::optional<nlohmann::json> read_until(std::chrono::steady_clock::time_point deadline);
 
     void write(const nlohmann::json&) override;
     void write(nlohmann::json&&) override;
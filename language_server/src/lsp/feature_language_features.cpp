@@ -15,7 +15,9 @@
 
 #include "feature_language_features.h"
 
+#include <algorithm>
 #include <functional>
+#include <ranges>
 #include <stack>
 #include <utility>
 
@@ -67,9 +69,9 @@ std::string extract_document_uri(const nlohmann::json& j)
 
     return uri->get<std::string>();
 }
-position extract_position(const nlohmann::json& j)
+position extract_position(const nlohmann::json& j, std::string_view name = "position")
 {
-    auto pos = j.find("position");
+    auto pos = j.find(name);
     if (pos == j.end() || !pos->is_object())
         return {};
     auto line = pos->find("line");
@@ -79,6 +81,22 @@ position extract_position(const nlohmann::json& j)
 
     return position(line->get<int>(), character->get<int>());
 }
+range extract_range(const nlohmann::json& j)
+{
+    auto rng = j.find("range");
+    if (rng == j.end() || !rng->is_object())
+        return {};
+
+    return range(extract_position(*rng, "start"), extract_position(*rng, "end"));
+}
+std::string extract_previous_result_id(const nlohmann::json& j)
+{
+    auto id = j.find("previousResultId");
+    if (id == j.end() || !id->is_string())
+        return {};
+
+    return id->get<std::string>();
+}
 
 auto extract_trigger(const nlohmann::json& j, const utils::text_convertor* tc)
 {
@@ -245,6 +263,8 @@ void feature_language_features::register_methods(std::map<std::string, method>&
     add_method("textDocument/completion", &feature_language_features::completion, LOG_EVENT);
     add_method("completionItem/resolve", &feature_language_features::completion_resolve);
     add_method("textDocument/semanticTokens/full", &feature_language_features::semantic_tokens);
+    add_method("textDocument/semanticTokens/full/delta", &feature_language_features::semantic_tokens_delta);
+    add_method("textDocument/semanticTokens/range", &feature_language_features::semantic_tokens_range);
     add_method("textDocument/documentSymbol", &feature_language_features::document_symbol);
     add_method("textDocument/$/opcode_suggestion", &feature_language_features::opcode_suggestion);
     add_method("textDocument/$/branch_information", &feature_language_features::branch_information);
@@ -309,7 +329,8 @@ nlohmann::json feature_language_features::register_capabilities()
                         { "tokenModifiers", nlohmann::json::array() },
                     },
                 },
-                { "full", true },
+                { "full", { { "delta", true } } },
+                { "range", true },
             },
         },
         { "documentSymbolProvider", true },
@@ -428,7 +449,7 @@ void feature_language_features::completion_resolve(const request_id& id, const n
     response_->respond(id, "", std::move(response));
 }
 
-void add_token(nlohmann::json& encoded_tokens,
+void add_token(std::vector<size_t>& encoded_tokens,
     const parser_library::token_info& current,
     parser_library::range& last_rng,
     bool first)
@@ -454,20 +475,26 @@ void add_token(nlohmann::json& encoded_tokens,
     encoded_tokens.push_back(delta_char);
     encoded_tokens.push_back(length);
     encoded_tokens.push_back(static_cast<std::underlying_type_t<hl_scopes>>(current.scope));
-    encoded_tokens.push_back((size_t)0);
+    encoded_tokens.push_back(0);
 
     last_rng = current.token_range;
 }
 
 nlohmann::json feature_language_features::convert_tokens_to_num_array(
     std::span<const parser_library::token_info> tokens)
+{
+    return encode_tokens(tokens);
+}
+
+std::vector<size_t> feature_language_features::encode_tokens(std::span<const parser_library::token_info> tokens)
 {
     using namespace parser_library;
 
     if (tokens.empty())
-        return nlohmann::json::array();
+        return {};
 
-    auto encoded_tokens = nlohmann::json::array();
+    std::vector<size_t> encoded_tokens;
+    encoded_tokens.reserve(tokens.size() * 5);
 
 
     range last_rng;
@@ -535,9 +562,11 @@ void feature_language_features::semantic_tokens(const request_id& id, const nloh
 {
     auto document_uri = extract_document_uri(params);
 
-    auto resp = make_response(id, response_, [](std::span<const token_info> token_list) {
+    auto resp = make_response(id, response_, [this, document_uri](const semantic_tokens_info& tokens) {
+        const auto& [result_id, _, data] = retain_semantic_tokens(document_uri, tokens);
         return nlohmann::json {
-            { "data", convert_tokens_to_num_array(token_list) },
+            { "resultId", std::to_string(result_id) },
+            { "data", data },
         };
     });
     ws_mngr_.semantic_tokens(document_uri, resp);
@@ -545,6 +574,105 @@ void feature_language_features::semantic_tokens(const request_id& id, const nloh
     response_->register_cancellable_request(id, std::move(resp));
 }
 
+void feature_language_features::semantic_tokens_delta(const request_id& id, const nlohmann::json& params)
+{
+    auto document_uri = extract_document_uri(params);
+    auto previous_result_id = extract_previous_result_id(params);
+
+    auto resp = make_response(
+        id, response_, [this, document_uri, previous_result_id](const semantic_tokens_info& tokens) {
+            std::vector<size_t> changed_previous;
+            bool has_previous = false;
+            bool unchanged = false;
+            if (auto it = m_semantic_tokens.find(document_uri);
+                it != m_semantic_tokens.end() && std::to_string(it->second.result_id) == previous_result_id)
+            {
+                has_previous = true;
+                unchanged = it->second.generation == tokens.generation;
+                if (!unchanged)
+                    changed_previous = std::move(it->second.data);
+            }
+
+            const auto& [result_id, _, data] = retain_semantic_tokens(document_uri, tokens);
+            if (!has_previous)
+            {
+                return nlohmann::json {
+                    { "resultId", std::to_string(result_id) },
+                    { "data", data },
+                };
+            }
+            const auto& previous = unchanged ? data : changed_previous;
+
+            // a single edit replacing everything between the common prefix and the common suffix
+            const size_t prefix = std::ranges::mismatch(previous, data).in1 - previous.begin();
+            size_t suffix = 0;
+            while (suffix < previous.size() - prefix && suffix < data.size() - prefix
+                && previous[previous.size() - 1 - suffix] == data[data.size() - 1 - suffix])
+                ++suffix;
+
+            auto edits = nlohmann::json::array();
+            if (const auto delete_count = previous.size() - prefix - suffix;
+                delete_count || data.size() - prefix - suffix)
+            {
+                edits.push_back(nlohmann::json {
+                    { "start", prefix },
+                    { "deleteCount", delete_count },
+                    { "data", std::vector<size_t>(data.begin() + prefix, data.end() - suffix) },
+                });
+            }
+
+            return nlohmann::json {
+                { "resultId", std::to_string(result_id) },
+                { "edits", std::move(edits) },
+            };
+        });
+    ws_mngr_.semantic_tokens(document_uri, resp);
+
+    response_->register_cancellable_request(id, std::move(resp));
+}
+
+void feature_language_features::semantic_tokens_range(const request_id& id, const nlohmann::json& params)
+{
+    auto document_uri = extract_document_uri(params);
+    auto rng = extract_range(params);
+
+    auto resp = make_response(id, response_, [rng](const semantic_tokens_info& tokens) {
+        const auto& token_list = tokens.tokens;
+        const auto first = std::ranges::partition_point(
+            token_list, [&rng](const auto& t) { return t.token_range.start.line < rng.start.line; });
+        const auto last = std::ranges::partition_point(std::ranges::subrange(first, token_list.end()),
+            [&rng](const auto& t) { return t.token_range.start.line <= rng.end.line; });
+
+        return nlohmann::json {
+            { "data", encode_tokens(std::span(first, last)) },
+        };
+    });
+    ws_mngr_.semantic_tokens(document_uri, resp);
+
+    response_->register_cancellable_request(id, std::move(resp));
+}
+
+const feature_language_features::semantic_tokens_result& feature_language_features::retain_semantic_tokens(
+    const std::string& document_uri, const parser_library::semantic_tokens_info& tokens)
+{
+    auto [it, inserted] = m_semantic_tokens.try_emplace(document_uri);
+    it->second.result_id = ++m_semantic_tokens_result_id;
+    if (inserted || it->second.generation != tokens.generation)
+    {
+        it->second.generation = tokens.generation;
+        it->second.data = encode_tokens(tokens.tokens);
+    }
+
+    if (inserted && m_semantic_tokens.size() > retained_semantic_tokens_limit)
+    {
+        // evict the document that was not requested for the longest time
+        m_semantic_tokens.erase(
+            std::ranges::min_element(m_semantic_tokens, {}, [](const auto& e) { return e.second.result_id; }));
+    }
+
+    return it->second;
+}
+
 // document symbol item kinds from the LSP specification
 enum class lsp_document_symbol_item_kind
 {
@@ -836,18 +964,35 @@ void feature_language_features::retrieve_outputs(const request_id& id, const nlo
 {
     auto document_uri = extract_document_uri(params);
 
-    auto resp = make_response(id, response_, [this](std::span<const output_line> outputs) {
+    // optional paging of large outputs
+    size_t first = 0;
+    size_t count = (size_t)-1;
+    if (auto f = params.find("first"); f != params.end() && f->is_number_unsigned())
+        first = f->get<size_t>();
+    if (auto c = params.find("count"); c != params.end() && c->is_number_unsigned())
+        count = c->get<size_t>();
+
+    auto resp = make_response(id, response_, [this](const output_page& page) {
+        nlohmann::json lines;
         if (!m_text_convertor)
-            return nlohmann::json(outputs);
-        std::vector<output_line> lines;
-        lines.reserve(outputs.size());
-        std::ranges::transform(outputs, std::back_inserter(lines), [this](const output_line& l) {
-            return output_line { l.level, utils::conversion_helper(m_text_convertor).convert_to(l.text) };
-        });
-        return nlohmann::json(std::move(lines));
+            lines = page.lines;
+        else
+        {
+            std::vector<output_line> converted;
+            converted.reserve(page.lines.size());
+            std::ranges::transform(page.lines, std::back_inserter(converted), [this](const output_line& l) {
+                return output_line { l.level, utils::conversion_helper(m_text_convertor).convert_to(l.text) };
+            });
+            lines = std::move(converted);
+        }
+        // pages of a different generation were taken from the output of another analysis
+        return nlohmann::json {
+            { "lines", std::move(lines) },
+            { "generation", page.generation },
+        };
     });
 
-    ws_mngr_.retrieve_output(document_uri, resp);
+    ws_mngr_.retrieve_output(document_uri, first, count, resp);
 
     response_->register_cancellable_request(id, std::move(resp));
 }
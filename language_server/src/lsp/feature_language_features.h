@@ -40,6 +40,7 @@ public:
     void initialize_feature(const nlohmann::json& initialise_params) override;
 
     static nlohmann::json convert_tokens_to_num_array(std::span<const parser_library::token_info> tokens);
+    static std::vector<size_t> encode_tokens(std::span<const parser_library::token_info> tokens);
 
 private:
     void definition(const request_id& id, const nlohmann::json& params);
@@ -48,6 +49,8 @@ private:
     void completion(const request_id& id, const nlohmann::json& params);
     void completion_resolve(const request_id& id, const nlohmann::json& params);
     void semantic_tokens(const request_id& id, const nlohmann::json& params);
+    void semantic_tokens_delta(const request_id& id, const nlohmann::json& params);
+    void semantic_tokens_range(const request_id& id, const nlohmann::json& params);
     void document_symbol(const request_id& id, const nlohmann::json& params);
     void opcode_suggestion(const request_id& id, const nlohmann::json& params);
     void branch_information(const request_id& id, const nlohmann::json& params);
@@ -64,6 +67,21 @@ private:
     nlohmann::json translate_completion_list_and_save_doc(
         std::span<const hlasm_plugin::parser_library::completion_item> list);
     std::unordered_map<std::string, std::string> saved_completion_list_doc;
+
+    // the last encoded semantic tokens sent for a document, delta requests are computed against them
+    // and they are reused as long as the generation of the tokens stays the same
+    struct semantic_tokens_result
+    {
+        size_t result_id = 0;
+        unsigned long long generation = 0;
+        std::vector<size_t> data;
+    };
+    static constexpr size_t retained_semantic_tokens_limit = 16;
+    std::unordered_map<std::string, semantic_tokens_result> m_semantic_tokens;
+    size_t m_semantic_tokens_result_id = 0;
+
+    const semantic_tokens_result& retain_semantic_tokens(
+        const std::string& document_uri, const parser_library::semantic_tokens_info& tokens);
 };
 
 } // namespace hlasm_plugin::language_server::lsp
@@ -151,6 +151,7 @@ void feature_workspace_folders::send_configuration_request()
         "items",
         nlohmann::json::array_t {
             { { "section", "hlasm.diagnosticsSuppressLimit" } },
+            { { "section", "hlasm.minimalLibraryIndex" } },
             nlohmann::json::object(),
         },
     } };
@@ -165,7 +166,7 @@ void feature_workspace_folders::send_configuration_request()
 
 void feature_workspace_folders::configuration(const nlohmann::json& params) const
 {
-    if (params.size() != 2)
+    if (params.size() != 3)
     {
         LOG_WARNING("Unexpected configuration response received.");
         return;
@@ -179,7 +180,9 @@ void feature_workspace_folders::configuration(const nlohmann::json& params) cons
         if (cfg.diag_supress_limit < 0)
             cfg.diag_supress_limit = 0;
     }
-    const auto& full_cfg = params[1];
+    if (const auto& minimal_index = params[1]; minimal_index.is_boolean())
+        cfg.minimal_lsp_index = minimal_index.get<bool>();
+    const auto& full_cfg = params[2];
 
     ws_mngr_.configuration_changed(cfg, full_cfg.dump());
 }
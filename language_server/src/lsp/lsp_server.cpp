@@ -20,8 +20,10 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "../logger.h"
 #include "diagnostic.h"
@@ -427,42 +429,110 @@ nlohmann::json create_diag_json(const parser_library::range& r,
 }
 } // namespace
 
+namespace {
+std::size_t hash_string(std::size_t h, std::string_view s)
+{
+    return utils::hashers::hash_combine(h, std::hash<std::string_view>()(s));
+}
+
+std::size_t hash_range(std::size_t h, const parser_library::range& r)
+{
+    for (auto v : { r.start.line, r.start.column, r.end.line, r.end.column })
+        h = utils::hashers::hash_combine(h, v);
+    return h;
+}
+
+std::size_t hash_diagnostic(std::size_t h, const parser_library::diagnostic& d)
+{
+    h = hash_range(h, d.diag_range);
+    h = utils::hashers::hash_combine(h, static_cast<std::size_t>(d.severity));
+    h = hash_string(h, d.code);
+    h = hash_string(h, d.source);
+    h = hash_string(h, d.message);
+    for (const auto& r : d.related)
+    {
+        h = hash_string(h, r.location.uri);
+        h = hash_range(h, r.location.rang);
+        h = hash_string(h, r.message);
+    }
+    return utils::hashers::hash_combine(h, static_cast<std::size_t>(d.tag));
+}
+
+std::size_t hash_fade_message(std::size_t h, const parser_library::fade_message& fm)
+{
+    h = hash_range(h, fm.r);
+    h = hash_string(h, fm.code);
+    return hash_string(h, fm.message);
+}
+} // namespace
+
 void server::consume_diagnostics(std::span<const parser_library::diagnostic> diagnostics,
     std::span<const parser_library::fade_message> fade_messages)
 {
-    std::unordered_map<std::string, nlohmann::json::array_t, utils::hashers::string_hasher, std::equal_to<>> diag_jsons;
-
-    const utils::conversion_helper tc(m_text_convertor);
+    struct file_diagnostics
+    {
+        std::vector<const parser_library::diagnostic*> diags;
+        std::vector<const parser_library::fade_message*> fade_messages;
+        std::size_t hash = 0;
+    };
+    std::unordered_map<std::string_view, file_diagnostics> files;
 
     for (const auto& d : diagnostics)
     {
-        diag_jsons[d.file_uri].emplace_back(create_diag_json(d.diag_range,
-            d.code,
-            d.source,
-            tc.convert_to(d.message),
-            diagnostic_related_info_to_json(d),
-            d.severity,
-            d.tag));
+        auto& f = files[d.file_uri];
+        f.diags.push_back(&d);
+        f.hash = hash_diagnostic(f.hash, d);
     }
 
     for (const auto& fm : fade_messages)
     {
-        diag_jsons[fm.uri].emplace_back(create_diag_json(fm.r,
-            fm.code,
-            fm.source,
-            tc.convert_to(fm.message),
-            std::nullopt,
-            parser_library::diagnostic_severity::hint,
-            parser_library::diagnostic_tag::unnecessary));
+        auto& f = files[fm.uri];
+        f.fade_messages.push_back(&fm);
+        f.hash = hash_fade_message(f.hash, fm);
     }
 
+    const utils::conversion_helper tc(m_text_convertor);
+
     // set of all files for which diagnostics came from the server.
-    std::unordered_set<std::string> new_files;
-    // transform the diagnostics into json
-    for (auto& [uri, diag_json] : diag_jsons)
+    decltype(last_diagnostics_files_) new_files;
+    // transform the changed diagnostics into json
+    for (const auto& [uri, f] : files)
     {
-        new_files.insert(uri);
-        last_diagnostics_files_.erase(uri);
+        const auto hash = utils::hashers::hash_combine(f.hash, f.diags.size() + f.fade_messages.size());
+        new_files.try_emplace(std::string(uri), hash);
+
+        if (auto it = last_diagnostics_files_.find(uri); it != last_diagnostics_files_.end())
+        {
+            const bool unchanged = it->second == hash;
+            last_diagnostics_files_.erase(it);
+            if (unchanged)
+                continue;
+        }
+
+        nlohmann::json::array_t diag_json;
+        diag_json.reserve(f.diags.size() + f.fade_messages.size());
+
+        for (const auto* d : f.diags)
+        {
+            diag_json.emplace_back(create_diag_json(d->diag_range,
+                d->code,
+                d->source,
+                tc.convert_to(d->message),
+                diagnostic_related_info_to_json(*d),
+                d->severity,
+                d->tag));
+        }
+
+        for (const auto* fm : f.fade_messages)
+        {
+            diag_json.emplace_back(create_diag_json(fm->r,
+                fm->code,
+                fm->source,
+                tc.convert_to(fm->message),
+                std::nullopt,
+                parser_library::diagnostic_severity::hint,
+                parser_library::diagnostic_tag::unnecessary));
+        }
 
         nlohmann::json publish_diags_params {
             { "uri", uri },
@@ -474,10 +544,10 @@ void server::consume_diagnostics(std::span<const parser_library::diagnostic> dia
     // for each file that had at least one diagnostic in the previous call of this function,
     // but does not have any diagnostics in this call, we send empty diagnostics array to
     // remove the diags from UI
-    for (auto& it : last_diagnostics_files_)
+    for (const auto& [uri, _] : last_diagnostics_files_)
     {
         nlohmann::json publish_diags_params {
-            { "uri", it },
+            { "uri", uri },
             { "diagnostics", nlohmann::json::array() },
         };
         notify("textDocument/publishDiagnostics", std::move(publish_diags_params));
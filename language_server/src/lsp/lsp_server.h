@@ -16,13 +16,16 @@
 #define HLASMPLUGIN_HLASMLANGUAGESERVER_LSP_SERVER_H
 
 #include <atomic>
+#include <cstddef>
+#include <functional>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 
 #include "../server.h"
 #include "../telemetry_sink.h"
 #include "nlohmann/json_fwd.hpp"
 #include "progress_notification.h"
+#include "utils/general_hashers.h"
 #include "watcher_registration_provider.h"
 #include "workspace_manager.h"
 #include "workspace_manager_requests.h"
@@ -110,11 +113,13 @@ private:
     void show_message(std::string_view message, parser_library::message_type type) override;
 
     // Remembers name of files for which were sent diagnostics the last time
-    // diagnostics were sent to client. Used to clear diagnostics in client
-    // when no more diags are produced by server for particular file.
-    std::unordered_set<std::string> last_diagnostics_files_;
-    // Implements parser_library::diagnostics_consumer: wraps the diagnostics in json and
-    // sends them to client.
+    // diagnostics were sent to client together with a hash of their content.
+    // Used to skip files whose diagnostics did not change and to clear diagnostics
+    // in client when no more diags are produced by server for particular file.
+    std::unordered_map<std::string, std::size_t, utils::hashers::string_hasher, std::equal_to<>>
+        last_diagnostics_files_;
+    // Implements parser_library::diagnostics_consumer: wraps the diagnostics of files
+    // whose diagnostics changed in json and sends them to client.
     void consume_diagnostics(std::span<const parser_library::diagnostic> diagnostics,
         std::span<const parser_library::fade_message> fade_messages) override;
 
@@ -12,9 +12,11 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <chrono>
 #include <optional>
 #include <span>
 #include <thread>
+#include <utility>
 
 #include "pseudo_convertors.h"
 #include "server_options.h"
@@ -34,6 +36,7 @@
 #include "telemetry_broker.h"
 #include "utils/scope_exit.h"
 #include "virtual_file_provider.h"
+#include "workspace_index_file.h"
 #include "workspace_manager.h"
 
 using namespace hlasm_plugin::language_server;
@@ -42,9 +45,14 @@ namespace {
 
 class main_program final : public json_sink,
                            send_message_provider,
-                           hlasm_plugin::parser_library::debugger_configuration_provider
+                           hlasm_plugin::parser_library::debugger_configuration_provider,
+                           hlasm_plugin::parser_library::idle_handler_wakeup
 {
+    // outlives the workspace manager which may wake the lsp thread until it is destroyed
+    json_queue_channel lsp_queue;
+
     external_file_reader external_files;
+    std::optional<workspace_index_file> index_file;
     std::unique_ptr<hlasm_plugin::parser_library::workspace_manager> ws_mngr;
 
     hlasm_plugin::parser_library::debugger_configuration_provider& dc_provider;
@@ -52,11 +60,12 @@ class main_program final : public json_sink,
     std::deque<std::function<void()>> proxies;
 
     json_sink& json_output;
-    json_queue_channel lsp_queue;
 
     message_router router;
 
     std::thread lsp_thread;
+    // only accessed by the lsp thread
+    std::optional<std::chrono::steady_clock::time_point> wakeup_deadline;
     telemetry_broker dap_telemetry_broker;
     dap::session_manager dap_sessions;
     virtual_file_provider virtual_files;
@@ -75,13 +84,36 @@ class main_program final : public json_sink,
         lsp_queue.write(nlohmann::json::value_t::discarded);
     }
 
+    void wake_up() override { lsp_queue.write(nlohmann::json::value_t::discarded); }
+
+    void wake_up_after(std::chrono::milliseconds delay) override
+    {
+        const auto deadline = std::chrono::steady_clock::now() + delay;
+        if (!wakeup_deadline || deadline < *wakeup_deadline)
+            wakeup_deadline = deadline;
+    }
+
 public:
-    main_program(json_sink& json_output, int& ret, bool use_vscode_extensions, pseudo_charsets pc)
+    main_program(json_sink& json_output,
+        int& ret,
+        bool use_vscode_extensions,
+        pseudo_charsets pc,
+        unsigned io_concurrency,
+        unsigned check_concurrency,
+        std::chrono::milliseconds max_reparse_delay,
+        std::string_view workspace_index)
         : external_files(json_output)
+        , index_file(workspace_index.empty() ? std::nullopt
+                                             : std::optional<workspace_index_file>(std::in_place, workspace_index))
         , ws_mngr(hlasm_plugin::parser_library::create_workspace_manager({
               .external_requests = &external_files,
               .text_conversion = get_text_convertor(pc),
               .vscode_extensions = use_vscode_extensions,
+              .io_concurrency = io_concurrency,
+              .check_concurrency = check_concurrency,
+              .wakeup = this,
+              .max_reparse_delay = max_reparse_delay,
+              .index_storage = index_file ? &*index_file : nullptr,
           }))
         , dc_provider(ws_mngr->get_debugger_configuration_provider())
         , json_output(json_output)
@@ -113,7 +145,9 @@ public:
                     if (lsp_queue.will_read_block())
                         ws_mngr->idle_handler(lsp_queue.will_block_preview());
 
-                    auto message = lsp_queue.read();
+                    auto message = wakeup_deadline
+                        ? lsp_queue.read_until(*std::exchange(wakeup_deadline, std::nullopt))
+                        : lsp_queue.read();
                     if (!message.has_value())
                     {
                         ret = 1;
@@ -189,7 +223,15 @@ void log_options(server_options opts)
         ", lsp-port=",
         std::to_string(opts.port),
         ", pseudo-charset=",
-        to_string(opts.pseudo_charset));
+        to_string(opts.pseudo_charset),
+        ", io-concurrency=",
+        std::to_string(opts.io_concurrency),
+        ", check-concurrency=",
+        std::to_string(opts.check_concurrency),
+        ", max-reparse-delay=",
+        std::to_string(opts.max_reparse_delay),
+        ", workspace-index=",
+        opts.workspace_index);
 }
 
 } // namespace
@@ -220,7 +262,14 @@ int main(int argc, char** argv)
     {
         int ret = 0;
 
-        main_program pgm(io_setup->get_response_stream(), ret, opts->enable_vscode_extension, opts->pseudo_charset);
+        main_program pgm(io_setup->get_response_stream(),
+            ret,
+            opts->enable_vscode_extension,
+            opts->pseudo_charset,
+            opts->io_concurrency,
+            opts->check_concurrency,
+            std::chrono::milliseconds(opts->max_reparse_delay),
+            opts->workspace_index);
 
         for (auto& source = io_setup->get_request_stream();;)
         {
@@ -49,6 +49,7 @@ void to_json(nlohmann::json& j, const parser_library::parsing_metadata& metadata
     j = nlohmann::json { { "properties", metadata.ws_info }, { "measurements", metadata.metrics } };
     j["measurements"]["error_count"] = metadata.errors;
     j["measurements"]["warning_count"] = metadata.warnings;
+    j["measurements"]["cancelled_analyses"] = metadata.cancelled_analyses;
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -49,6 +49,43 @@ std::optional<server_options> parse_options(std::span<const char* const> args)
             if (err != std::errc {} || ptr != std::to_address(arg.end()) || result.port == 0)
                 return std::nullopt;
         }
+        else if (static constexpr std::string_view io_concurrency = "--io-concurrency=";
+                 arg.starts_with(io_concurrency))
+        {
+            arg.remove_prefix(io_concurrency.size());
+            auto [ptr, err] =
+                std::from_chars(std::to_address(arg.begin()), std::to_address(arg.end()), result.io_concurrency);
+            if (err != std::errc {} || ptr != std::to_address(arg.end())
+                || result.io_concurrency > server_options::max_io_concurrency)
+                return std::nullopt;
+        }
+        else if (static constexpr std::string_view check_concurrency = "--check-concurrency=";
+                 arg.starts_with(check_concurrency))
+        {
+            arg.remove_prefix(check_concurrency.size());
+            auto [ptr, err] =
+                std::from_chars(std::to_address(arg.begin()), std::to_address(arg.end()), result.check_concurrency);
+            if (err != std::errc {} || ptr != std::to_address(arg.end())
+                || result.check_concurrency > server_options::max_check_concurrency)
+                return std::nullopt;
+        }
+        else if (static constexpr std::string_view max_reparse_delay = "--max-reparse-delay=";
+                 arg.starts_with(max_reparse_delay))
+        {
+            arg.remove_prefix(max_reparse_delay.size());
+            auto [ptr, err] =
+                std::from_chars(std::to_address(arg.begin()), std::to_address(arg.end()), result.max_reparse_delay);
+            if (err != std::errc {} || ptr != std::to_address(arg.end()))
+                return std::nullopt;
+        }
+        else if (static constexpr std::string_view workspace_index = "--workspace-index=";
+                 arg.starts_with(workspace_index))
+        {
+            arg.remove_prefix(workspace_index.size());
+            if (arg.empty())
+                return std::nullopt;
+            result.workspace_index = arg;
+        }
         else if (static constexpr std::string_view pseudo_charset = "--pseudo-charset=";
                  arg.starts_with(pseudo_charset))
         {
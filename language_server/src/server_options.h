@@ -31,10 +31,20 @@ std::string_view to_string(pseudo_charsets pc);
 
 struct server_options
 {
+    static constexpr unsigned max_io_concurrency = 255;
+    static constexpr unsigned max_check_concurrency = 255;
+
     uint16_t port = 0;
     bool enable_vscode_extension = false;
     signed char log_level = -1;
     pseudo_charsets pseudo_charset = {};
+    unsigned io_concurrency = 8;
+    // additional threads checking the operands of large programs
+    unsigned check_concurrency = 0;
+    // milliseconds, zero disables coalescing of edits
+    uint16_t max_reparse_delay = 500;
+    // file with the cross-program index of the workspace, empty disables the persistence
+    std::string_view workspace_index;
 };
 std::optional<server_options> parse_options(std::span<const char* const> args);
 
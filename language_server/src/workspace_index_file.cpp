@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "workspace_index_file.h"
+
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+namespace hlasm_plugin::language_server {
+
+workspace_index_file::workspace_index_file(std::filesystem::path path)
+    : m_path(std::move(path))
+    , m_writer([this]() { writer_routine(); })
+{}
+
+workspace_index_file::~workspace_index_file()
+{
+    {
+        std::lock_guard g(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_writer.join();
+}
+
+void workspace_index_file::writer_routine()
+{
+    std::unique_lock g(m_mutex);
+    while (true)
+    {
+        m_cv.wait(g, [this]() { return m_stop || m_pending.has_value(); });
+        if (!m_pending)
+            return;
+
+        auto data = std::move(*m_pending);
+        m_pending.reset();
+        m_writing = true;
+
+        g.unlock();
+        write(data);
+        g.lock();
+
+        m_writing = false;
+        m_cv.notify_all();
+    }
+}
+
+void workspace_index_file::flush()
+{
+    std::unique_lock g(m_mutex);
+    m_cv.wait(g, [this]() { return !m_pending && !m_writing; });
+}
+
+std::optional<std::string> workspace_index_file::load() noexcept
+{
+    try
+    {
+        std::ifstream in(m_path, std::ios::in | std::ios::binary);
+        if (!in)
+            return std::nullopt;
+
+        std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (in.bad())
+            return std::nullopt;
+
+        return data;
+    }
+    catch (...)
+    {
+        return std::nullopt;
+    }
+}
+
+void workspace_index_file::store(std::string_view data) noexcept
+{
+    try
+    {
+        {
+            std::lock_guard g(m_mutex);
+            m_pending.emplace(data);
+        }
+        m_cv.notify_all();
+    }
+    catch (...)
+    {}
+}
+
+void workspace_index_file::write(std::string_view data) const noexcept
+{
+    try
+    {
+        std::error_code ec;
+        if (m_path.has_parent_path())
+        {
+            std::filesystem::create_directories(m_path.parent_path(), ec);
+            if (ec)
+                return;
+        }
+
+        auto temp = m_path;
+        temp += ".tmp";
+
+        {
+            std::ofstream out(temp, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!out)
+                return;
+
+            out.write(data.data(), data.size());
+            if (!out.flush())
+            {
+                out.close();
+                std::filesystem::remove(temp, ec);
+                return;
+            }
+        }
+
+        // the previous index stays intact until the new one is complete
+        std::filesystem::rename(temp, m_path, ec);
+        if (ec)
+            std::filesystem::remove(temp, ec);
+    }
+    catch (...)
+    {}
+}
+
+} // namespace hlasm_plugin::language_server
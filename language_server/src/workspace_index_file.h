@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_LANGUAGESERVER_WORKSPACE_INDEX_FILE_H
+#define HLASMPLUGIN_LANGUAGESERVER_WORKSPACE_INDEX_FILE_H
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "workspace_manager.h"
+
+namespace hlasm_plugin::language_server {
+
+// keeps the workspace index in a single file
+// the file is written by a background thread, only the latest pending data is kept
+class workspace_index_file final : public parser_library::workspace_index_storage
+{
+    std::filesystem::path m_path;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::optional<std::string> m_pending;
+    bool m_writing = false;
+    bool m_stop = false;
+    std::thread m_writer;
+
+    void write(std::string_view data) const noexcept;
+    void writer_routine();
+
+public:
+    explicit workspace_index_file(std::filesystem::path path);
+    workspace_index_file(const workspace_index_file&) = delete;
+    workspace_index_file& operator=(const workspace_index_file&) = delete;
+    // writes the pending data
+    ~workspace_index_file();
+
+    // failures are ignored, the index is then rebuilt by the analyses
+    std::optional<std::string> load() noexcept override;
+    void store(std::string_view data) noexcept override;
+
+    // waits until the pending data is written
+    void flush();
+};
+
+} // namespace hlasm_plugin::language_server
+
+#endif // !HLASMPLUGIN_LANGUAGESERVER_WORKSPACE_INDEX_FILE_H
@@ -12,6 +12,7 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <chrono>
 #include <sstream>
 #include <thread>
 #include <utility>
@@ -83,6 +84,19 @@ TEST(blocking_queue, terminate)
     EXPECT_FALSE(queue.pop().has_value());
 }
 
+TEST(blocking_queue, pop_until)
+{
+    blocking_queue<int> queue;
+
+    EXPECT_EQ(queue.pop_until(std::chrono::steady_clock::now(), -1), -1);
+
+    queue.push(1);
+    EXPECT_EQ(queue.pop_until(std::chrono::steady_clock::now(), -1), 1);
+
+    queue.terminate();
+    EXPECT_FALSE(queue.pop_until(std::chrono::steady_clock::now(), -1).has_value());
+}
+
 TEST(blocking_queue, multithreaded)
 {
     constexpr int message_limit = 1024 * 1024;
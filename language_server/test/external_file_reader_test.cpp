@@ -367,3 +367,29 @@ TEST(external_file_reader, directory_reading_error)
   }
 })"_json);
 }
+
+TEST(external_file_reader, requests_in_flight)
+{
+    NiceMock<mock_json_sink> sink;
+    NiceMock<MockFunction<void()>> wakeup;
+
+    external_file_reader reader(sink);
+    auto reg = reader.register_thread(wakeup.AsStdFunction());
+
+    auto [r1, resp1] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    auto [r2, resp2] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+
+    // the second request is sent before the first one is answered
+    EXPECT_CALL(sink, write_rvr(_)).Times(2);
+
+    reader.read_external_file("LIB/A", r1);
+    reader.read_external_file("LIB/B", r2);
+
+    EXPECT_CALL(*resp1, provide(Truly([](std::string_view v) { return v == "ACONTENT"; })));
+    EXPECT_CALL(*resp2, provide(Truly([](std::string_view v) { return v == "BCONTENT"; })));
+
+    reader.write(R"({"jsonrpc":"2.0","method":"external_file_response","params":{"id":2,"data":"BCONTENT"}})"_json);
+    reader.write(R"({"jsonrpc":"2.0","method":"external_file_response","params":{"id":1,"data":"ACONTENT"}})"_json);
+}
@@ -186,7 +186,10 @@ TEST(language_features, semantic_tokens)
     ws_mngr->did_open_file(uri, 0, file_text);
     nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
 
-    nlohmann::json response { { "data", { 0, 0, 1, 0, 0, 0, 2, 3, 1, 0, 0, 4, 1, 10, 0, 1, 1, 5, 1, 0 } } };
+    nlohmann::json response {
+        { "resultId", "1" },
+        { "data", { 0, 0, 1, 0, 0, 0, 2, 3, 1, 0, 0, 4, 1, 10, 0, 1, 1, 5, 1, 0 } },
+    };
     EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(response)));
 
     notifs["textDocument/semanticTokens/full"].as_request_handler()(request_id(0), params1);
@@ -238,7 +241,7 @@ IIIIIIIIIIIIIII1
     nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
 
     // clang-format off
-    nlohmann::json response { { "data",
+    nlohmann::json response { { "resultId", "1" }, { "data",
         { 1,0,1,0,0,      // label         D
             0,2,3,1,0,    // instruction   EQU
             0,68,1,10,0,  // number        1
@@ -273,7 +276,7 @@ TEST(language_features, semantic_tokens_multiline_overlap)
     nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
 
     // clang-format off
-    nlohmann::json response { { "data",
+    nlohmann::json response { { "resultId", "1" }, { "data",
         {   1,0,2,7,0,    // var symbol    &X
             0,3,4,1,0,    // instruction   SETC
             0,5,3,9,0,    // string        ' '
@@ -301,6 +304,103 @@ TEST(language_features, semantic_tokens_multiline_overlap)
 }
 
 
+TEST(language_features, semantic_tokens_delta)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(*ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    ws_mngr->did_open_file(uri, 0, "A EQU 1\n SAM31");
+    nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
+
+    nlohmann::json response1 {
+        { "resultId", "1" },
+        { "data", { 0, 0, 1, 0, 0, 0, 2, 3, 1, 0, 0, 4, 1, 10, 0, 1, 1, 5, 1, 0 } },
+    };
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(response1)));
+    notifs["textDocument/semanticTokens/full"].as_request_handler()(request_id(0), params1);
+    ws_mngr->idle_handler();
+
+    const parser_library::document_change change(parser_library::range({ 0, 0 }, { 0, 1 }), "AB");
+    ws_mngr->did_change_file(uri, 1, std::span(&change, 1));
+
+    nlohmann::json params2 = nlohmann::json::parse(
+        R"({"textDocument":{"uri":")" + uri + R"("},"previousResultId":"1"})");
+    nlohmann::json response2 {
+        { "resultId", "2" },
+        {
+            "edits",
+            nlohmann::json::array({
+                { { "start", 2 }, { "deleteCount", 5 }, { "data", { 2, 0, 0, 0, 3 } } },
+            }),
+        },
+    };
+    EXPECT_CALL(response_mock, respond(request_id(1), std::string(""), std::move(response2)));
+    notifs["textDocument/semanticTokens/full/delta"].as_request_handler()(request_id(1), params2);
+    ws_mngr->idle_handler();
+
+    // unknown result id results in a full response
+    nlohmann::json response3 {
+        { "resultId", "3" },
+        { "data", { 0, 0, 2, 0, 0, 0, 3, 3, 1, 0, 0, 4, 1, 10, 0, 1, 1, 5, 1, 0 } },
+    };
+    EXPECT_CALL(response_mock, respond(request_id(2), std::string(""), std::move(response3)));
+    notifs["textDocument/semanticTokens/full/delta"].as_request_handler()(request_id(2), params2);
+    ws_mngr->idle_handler();
+}
+
+TEST(language_features, semantic_tokens_range)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(*ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    ws_mngr->did_open_file(uri, 0, "A EQU 1\n SAM31\nB EQU 2");
+    nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri
+        + R"("},"range":{"start":{"line":1,"character":0},"end":{"line":1,"character":6}}})");
+
+    nlohmann::json response { { "data", { 1, 1, 5, 1, 0 } } };
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(response)));
+
+    notifs["textDocument/semanticTokens/range"].as_request_handler()(request_id(0), params1);
+
+    ws_mngr->idle_handler();
+}
+
+TEST(language_features, semantic_tokens_reused_for_same_generation)
+{
+    using namespace parser_library;
+    test::ws_mngr_mock ws_mngr;
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    const std::vector<token_info> tokens_a { token_info(0, 0, 0, 5, hl_scopes::instruction) };
+    const std::vector<token_info> tokens_b { token_info(0, 0, 0, 3, hl_scopes::remark) };
+    EXPECT_CALL(ws_mngr, semantic_tokens(StrEq(uri), _))
+        .WillOnce(WithArg<1>(Invoke([&tokens_a](auto channel) { channel.provide({ tokens_a, 1 }); })))
+        .WillOnce(WithArg<1>(Invoke([&tokens_b](auto channel) { channel.provide({ tokens_b, 1 }); })))
+        .WillOnce(WithArg<1>(Invoke([&tokens_b](auto channel) { channel.provide({ tokens_b, 2 }); })));
+
+    nlohmann::json params = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
+
+    // the second response is not encoded again, the tokens carry the same generation
+    EXPECT_CALL(response_mock,
+        respond(request_id(0), std::string(""), nlohmann::json { { "resultId", "1" }, { "data", { 0, 0, 5, 1, 0 } } }));
+    EXPECT_CALL(response_mock,
+        respond(request_id(1), std::string(""), nlohmann::json { { "resultId", "2" }, { "data", { 0, 0, 5, 1, 0 } } }));
+    EXPECT_CALL(response_mock,
+        respond(request_id(2), std::string(""), nlohmann::json { { "resultId", "3" }, { "data", { 0, 0, 3, 2, 0 } } }));
+
+    for (int i = 0; i < 3; ++i)
+        notifs["textDocument/semanticTokens/full"].as_request_handler()(request_id(i), params);
+}
+
 
 namespace {
 struct test_param
@@ -507,20 +607,74 @@ TEST(language_features, retrieve_output)
     ws_mngr->did_open_file(uri, 0, file_text);
     nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
 
-    nlohmann::json response = nlohmann::json::array();
-    response.push_back({
-        { "level", -1 },
-        { "text", "A" },
-    });
-    response.push_back({
-        { "level", 2 },
-        { "text", "B" },
-    });
+    nlohmann::json response;
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), _)).WillOnce(SaveArg<2>(&response));
+    notifs["textDocument/$/retrieve_outputs"].as_request_handler()(request_id(0), params1);
 
-    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(response)));
+    ws_mngr->idle_handler();
+
+    EXPECT_EQ(response["lines"], nlohmann::json::parse(R"([{"level":-1,"text":"A"},{"level":2,"text":"B"}])"));
+    EXPECT_TRUE(response["generation"].is_number_unsigned());
+}
+
+TEST(language_features, retrieve_output_paged)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(*ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    std::string file_text = " PUNCH 'A'\n MNOTE 2,'B'\n PUNCH 'C'";
+
+    ws_mngr->did_open_file(uri, 0, file_text);
+    nlohmann::json params1 =
+        nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + R"("},"first":1,"count":1})");
+    nlohmann::json params2 =
+        nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + R"("},"first":2,"count":5})");
+
+    nlohmann::json response1;
+    nlohmann::json response2;
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), _)).WillOnce(SaveArg<2>(&response1));
+    EXPECT_CALL(response_mock, respond(request_id(1), std::string(""), _)).WillOnce(SaveArg<2>(&response2));
     notifs["textDocument/$/retrieve_outputs"].as_request_handler()(request_id(0), params1);
+    notifs["textDocument/$/retrieve_outputs"].as_request_handler()(request_id(1), params2);
 
     ws_mngr->idle_handler();
+
+    EXPECT_EQ(response1["lines"], nlohmann::json::parse(R"([{"level":2,"text":"B"}])"));
+    EXPECT_EQ(response2["lines"], nlohmann::json::parse(R"([{"level":-1,"text":"C"}])"));
+    EXPECT_EQ(response1["generation"], response2["generation"]);
+}
+
+TEST(language_features, retrieve_output_generation)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(*ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    ws_mngr->did_open_file(uri, 0, " PUNCH 'A'");
+    nlohmann::json params = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + R"("},"first":0,"count":1})");
+
+    const auto retrieve = [&](request_id id) {
+        nlohmann::json response;
+        EXPECT_CALL(response_mock, respond(id, std::string(""), _)).WillOnce(SaveArg<2>(&response));
+        notifs["textDocument/$/retrieve_outputs"].as_request_handler()(id, params);
+        ws_mngr->idle_handler();
+        return response["generation"];
+    };
+
+    const auto original = retrieve(request_id(0));
+
+    std::vector<parser_library::document_change> same { parser_library::document_change(" PUNCH 'A' ") };
+    ws_mngr->did_change_file(uri, 1, same);
+    EXPECT_EQ(retrieve(request_id(1)), original);
+
+    std::vector<parser_library::document_change> changed { parser_library::document_change(" PUNCH 'B'") };
+    ws_mngr->did_change_file(uri, 2, changed);
+    EXPECT_NE(retrieve(request_id(2)), original);
 }
 
 TEST(language_features, retrieve_output_empty)
@@ -536,10 +690,11 @@ TEST(language_features, retrieve_output_empty)
     ws_mngr->did_open_file(uri, 0, file_text);
     nlohmann::json params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + "\"}}");
 
-    nlohmann::json response = nlohmann::json::array();
-
-    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(response)));
+    nlohmann::json response;
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), _)).WillOnce(SaveArg<2>(&response));
     notifs["textDocument/$/retrieve_outputs"].as_request_handler()(request_id(0), params1);
 
     ws_mngr->idle_handler();
+
+    EXPECT_EQ(response["lines"], nlohmann::json::array());
 }
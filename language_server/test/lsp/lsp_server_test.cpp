@@ -451,3 +451,41 @@ TEST(lsp_server_test, watcher_registration)
     provider->remove_watcher(dir2_1);
     provider->remove_watcher(dir2_2);
 }
+
+TEST(lsp_server_test, publish_changed_diagnostics_only)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    NiceMock<send_message_provider_mock> smpm;
+    lsp::server s(*ws_mngr, nullptr);
+    s.set_send_message_provider(&smpm);
+
+    const auto publish_diagnostics = [](const nlohmann::json& j) {
+        return j.contains("method") && j.at("method") == "textDocument/publishDiagnostics";
+    };
+
+    EXPECT_CALL(smpm, reply(_)).Times(AnyNumber());
+    EXPECT_CALL(smpm, reply(Truly(publish_diagnostics))).Times(1);
+
+    s.message_received(
+        R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{"textDocument":{"uri":"test:test","languageId":"hlasm","version":1,"text":"LABEL LR 1,20 REMARK"}}})"_json);
+    ws_mngr->idle_handler(nullptr);
+
+    // the diagnostics are the same, nothing is sent
+    s.message_received(
+        R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":"test:test","version":2},"contentChanges":[{"text":"LABEL LR 1,20 REMARX"}]}})"_json);
+    ws_mngr->idle_handler(nullptr);
+
+    Mock::VerifyAndClearExpectations(&smpm);
+
+    // the diagnostics disappeared
+    EXPECT_CALL(smpm, reply(_)).Times(AnyNumber());
+    EXPECT_CALL(smpm,
+        reply(Truly([&publish_diagnostics](const nlohmann::json& j) {
+            return publish_diagnostics(j) && j.at("params").at("diagnostics").empty();
+        })))
+        .Times(1);
+
+    s.message_received(
+        R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":"test:test","version":3},"contentChanges":[{"text":"LABEL LR 1,2"}]}})"_json);
+    ws_mngr->idle_handler(nullptr);
+}
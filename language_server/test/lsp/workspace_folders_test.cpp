@@ -198,6 +198,7 @@ TEST(workspace_folders, did_change_configuration)
             "items",
             nlohmann::json::array_t {
                 { { "section", "hlasm.diagnosticsSuppressLimit" } },
+                { { "section", "hlasm.minimalLibraryIndex" } },
                 nlohmann::json::object(),
             },
         },
@@ -210,12 +211,13 @@ TEST(workspace_folders, did_change_configuration)
 
     parser_library::lib_config expected_config;
     expected_config.diag_supress_limit = 42;
+    expected_config.minimal_lsp_index = false;
 
     EXPECT_CALL(ws_mngr,
         configuration_changed(Eq(expected_config),
             Eq(R"({"hlasm":{"diagnosticsSuppressLimit":42,"pgm_conf":{"pgms":[]},"proc_grps":{"pgroups":[]}}})")));
 
-    handler(R"([42,{"hlasm":{"diagnosticsSuppressLimit":42,"pgm_conf":{"pgms":[]},"proc_grps":{"pgroups":[]}}}])"_json);
+    handler(R"([42,false,{"hlasm":{"diagnosticsSuppressLimit":42,"pgm_conf":{"pgms":[]},"proc_grps":{"pgroups":[]}}}])"_json);
 }
 
 TEST(workspace_folders, did_change_configuration_with_requests)
@@ -254,6 +256,7 @@ TEST(workspace_folders, did_change_configuration_empty_configuration_params)
             "items",
             nlohmann::json::array_t {
                 { { "section", "hlasm.diagnosticsSuppressLimit" } },
+                { { "section", "hlasm.minimalLibraryIndex" } },
                 nlohmann::json::object(),
             },
         },
@@ -57,6 +57,78 @@ TEST(server_options, lsp_port)
     EXPECT_EQ(result->port, 12345);
 }
 
+TEST(server_options, io_concurrency)
+{
+    const char* const opts[] = {
+        "--io-concurrency=0",
+    };
+
+    auto result = parse_options(opts);
+
+    ASSERT_TRUE(result);
+
+    EXPECT_EQ(result->io_concurrency, 0);
+}
+
+TEST(server_options, error_io_concurrency_too_big)
+{
+    const char* const opts[] = {
+        "--io-concurrency=256",
+    };
+
+    auto result = parse_options(opts);
+
+    EXPECT_FALSE(result);
+}
+
+TEST(server_options, check_concurrency)
+{
+    const char* const opts[] = {
+        "--check-concurrency=4",
+    };
+
+    auto result = parse_options(opts);
+
+    ASSERT_TRUE(result);
+
+    EXPECT_EQ(result->check_concurrency, 4);
+}
+
+TEST(server_options, error_check_concurrency_too_big)
+{
+    const char* const opts[] = {
+        "--check-concurrency=256",
+    };
+
+    auto result = parse_options(opts);
+
+    EXPECT_FALSE(result);
+}
+
+TEST(server_options, max_reparse_delay)
+{
+    const char* const opts[] = {
+        "--max-reparse-delay=0",
+    };
+
+    auto result = parse_options(opts);
+
+    ASSERT_TRUE(result);
+
+    EXPECT_EQ(result->max_reparse_delay, 0);
+}
+
+TEST(server_options, error_max_reparse_delay)
+{
+    const char* const opts[] = {
+        "--max-reparse-delay=-1",
+    };
+
+    auto result = parse_options(opts);
+
+    EXPECT_FALSE(result);
+}
+
 TEST(server_options, error_extensions)
 {
     const char* const opts[] = {
@@ -100,3 +172,27 @@ TEST(server_options, log_level_too_big)
 
     EXPECT_FALSE(result);
 }
+
+TEST(server_options, workspace_index)
+{
+    const char* const opts[] = {
+        "--workspace-index=/tmp/index",
+    };
+
+    auto result = parse_options(opts);
+
+    ASSERT_TRUE(result);
+
+    EXPECT_EQ(result->workspace_index, "/tmp/index");
+}
+
+TEST(server_options, error_workspace_index_empty)
+{
+    const char* const opts[] = {
+        "--workspace-index=",
+    };
+
+    auto result = parse_options(opts);
+
+    EXPECT_FALSE(result);
+}
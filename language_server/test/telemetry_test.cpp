@@ -89,6 +89,7 @@ TEST(telemetry, lsp_server_did_open)
 
     EXPECT_GT(metrics["duration"], 0U);
     EXPECT_EQ(metrics["error_count"], 1);
+    EXPECT_EQ(metrics["cancelled_analyses"], 0);
 
     nlohmann::json& ws_info = telemetry_reply["params"]["properties"];
 
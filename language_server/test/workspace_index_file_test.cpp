@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "workspace_index_file.h"
+
+using namespace hlasm_plugin::language_server;
+
+namespace {
+class temporary_index
+{
+    std::filesystem::path m_path;
+
+public:
+    temporary_index()
+        : m_path(std::filesystem::temp_directory_path()
+              / (std::string("hlasm_workspace_index_")
+                  + ::testing::UnitTest::GetInstance()->current_test_info()->name())
+              / "index")
+    {
+        std::filesystem::remove_all(m_path.parent_path());
+    }
+    temporary_index(const temporary_index&) = delete;
+    temporary_index& operator=(const temporary_index&) = delete;
+    ~temporary_index()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_path.parent_path(), ec);
+    }
+
+    const std::filesystem::path& path() const { return m_path; }
+};
+} // namespace
+
+TEST(workspace_index_file, missing)
+{
+    temporary_index dir;
+    workspace_index_file file(dir.path());
+
+    EXPECT_EQ(file.load(), std::nullopt);
+}
+
+TEST(workspace_index_file, store_and_load)
+{
+    temporary_index dir;
+    workspace_index_file file(dir.path());
+
+    file.store("first");
+    file.store("second");
+    file.flush();
+
+    EXPECT_EQ(file.load(), "second");
+}
+
+TEST(workspace_index_file, pending_data_written_on_destruction)
+{
+    temporary_index dir;
+    {
+        workspace_index_file file(dir.path());
+        file.store("data");
+    }
+
+    EXPECT_EQ(workspace_index_file(dir.path()).load(), "data");
+}
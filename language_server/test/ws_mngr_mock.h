@@ -62,7 +62,7 @@ public:
 
 
     MOCK_METHOD(
-        void, semantic_tokens, (std::string_view, workspace_manager_response<std::span<const token_info>>), (override));
+        void, semantic_tokens, (std::string_view, workspace_manager_response<const semantic_tokens_info&>), (override));
     MOCK_METHOD(void,
         document_symbol,
         (std::string_view, workspace_manager_response<std::span<const document_symbol_item>>),
@@ -109,7 +109,10 @@ public:
 
     MOCK_METHOD(void,
         retrieve_output,
-        (std::string_view document_uri, workspace_manager_response<std::span<const output_line>> resp),
+        (std::string_view document_uri,
+            size_t first,
+            size_t count,
+            workspace_manager_response<const output_page&> resp),
         (override));
 
     MOCK_METHOD(void, change_implicit_group_base, (std::string_view uri), (override));
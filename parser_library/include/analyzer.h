@@ -57,8 +57,13 @@ namespace hlasm_plugin::parser_library::semantics {
 class source_info_processor;
 } // namespace hlasm_plugin::parser_library::semantics
 
+namespace hlasm_plugin::parser_library::workspaces {
+class io_worker_pool;
+} // namespace hlasm_plugin::parser_library::workspaces
+
 namespace hlasm_plugin::parser_library {
 struct fade_message;
+class lsp_detail_provider;
 class output_handler;
 class parse_lib_provider;
 class virtual_file_monitor;
@@ -86,6 +91,12 @@ struct diagnostic_limit
     size_t limit = static_cast<size_t>(-1);
 };
 
+// operands of the postponed statements are checked also on the threads of the pool once the open code is processed
+struct operand_check_pool
+{
+    workspaces::io_worker_pool* pool = nullptr;
+};
+
 class analyzer_options
 {
     class dependency_data
@@ -111,10 +122,12 @@ class analyzer_options
     virtual_file_monitor* vf_monitor = nullptr;
     std::shared_ptr<std::vector<fade_message>> fade_messages = nullptr;
     output_handler* output = nullptr;
+    const lsp_detail_provider* lsp_details = nullptr;
     std::string dep_name;
     processing::processing_kind dep_kind = processing::processing_kind::ORDINARY;
     diagnostic_limit diag_limit;
     external_functions_list external_functions;
+    operand_check_pool check_pool;
 
     void set(utils::resource::resource_location rl) { file_loc = std::move(rl); }
     void set(parse_lib_provider* lp) { lib_provider = lp; }
@@ -128,6 +141,7 @@ class analyzer_options
     void set(virtual_file_monitor* vfm) { vf_monitor = vfm; }
     void set(std::shared_ptr<std::vector<fade_message>> fmc) { fade_messages = fmc; };
     void set(output_handler* o) { output = o; }
+    void set(const lsp_detail_provider* ld) { lsp_details = ld; }
     void set(dependency_data d)
     {
         dep_kind = d.kind;
@@ -135,6 +149,7 @@ class analyzer_options
     }
     void set(diagnostic_limit dl) { diag_limit = dl; }
     void set(external_functions_list ef) { external_functions = std::move(ef); }
+    void set(operand_check_pool cp) { check_pool = cp; }
 
     context::hlasm_context& get_hlasm_context();
     analyzing_context& get_context();
@@ -168,11 +183,13 @@ public:
         constexpr auto fmc_cnt =
             (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<std::vector<fade_message>>>);
         constexpr auto o_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, output_handler*>);
+        constexpr auto ld_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, const lsp_detail_provider*>);
         constexpr auto dep_data_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, dependency_data>);
         constexpr auto diag_limit_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, diagnostic_limit>);
         constexpr auto ef_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, external_functions_list>);
+        constexpr auto cp_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, operand_check_pool>);
         constexpr auto cnt = rl_cnt + lib_cnt + ao_cnt + ac_cnt + hi_cnt + f_oc_cnt + ids_cnt + pp_cnt + vfm_cnt
-            + fmc_cnt + o_cnt + dep_data_cnt + diag_limit_cnt + ef_cnt;
+            + fmc_cnt + o_cnt + ld_cnt + dep_data_cnt + diag_limit_cnt + ef_cnt + cp_cnt;
 
         static_assert(rl_cnt <= 1, "Duplicate resource_location");
         static_assert(lib_cnt <= 1, "Duplicate parse_lib_provider");
@@ -188,9 +205,11 @@ public:
             "Do not specify both analyzing_context and asm_option, id_storage, preprocessor_args or "
             "external_functions");
         static_assert(o_cnt <= 1, "Duplicate output_handler");
+        static_assert(ld_cnt <= 1, "Duplicate lsp_detail_provider");
         static_assert(dep_data_cnt <= 1, "Duplicate dependency_data");
         static_assert(diag_limit_cnt <= 1, "Duplicate diagnostic_limit");
         static_assert(ef_cnt <= 1, "Duplicate external_functions");
+        static_assert(cp_cnt <= 1, "Duplicate operand_check_pool");
         static_assert(cnt == sizeof...(Args), "Unrecognized argument provided");
 
         (set(std::forward<Args>(args)), ...);
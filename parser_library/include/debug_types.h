@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 
 namespace hlasm_plugin::parser_library::debugging {
 
@@ -53,10 +54,16 @@ struct variable
 
 struct breakpoint
 {
-    explicit breakpoint(size_t line)
+    explicit breakpoint(size_t line, std::string_view condition = {}, std::string_view hit_condition = {})
         : line(line)
+        , condition(condition)
+        , hit_condition(hit_condition)
     {}
     size_t line;
+    // SETB-like conditional assembly expression, the breakpoint stops only when it evaluates to true
+    std::string condition;
+    // number of hits required to stop, optionally prefixed by one of ==, >, >=, <, <=, %
+    std::string hit_condition;
 };
 
 struct function_breakpoint
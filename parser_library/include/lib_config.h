@@ -28,6 +28,8 @@ struct lib_config
     [[nodiscard]] lib_config fill_missing_settings(const lib_config& second) const;
 
     std::optional<int64_t> diag_supress_limit;
+    // library members not opened in the editor only get a minimal lsp index
+    std::optional<bool> minimal_lsp_index;
 
     bool operator==(const lib_config&) const noexcept = default;
 };
@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
 
 #include "range.h"
@@ -110,6 +111,7 @@ struct parsing_metadata
     workspace_file_info ws_info;
     size_t errors = 0;
     size_t warnings = 0;
+    size_t cancelled_analyses = 0;
 };
 
 struct token_info
@@ -132,6 +134,13 @@ struct token_info
     bool operator==(const token_info& rhs) const noexcept = default;
 };
 
+struct semantic_tokens_info
+{
+    std::span<const token_info> tokens;
+    // changes whenever the tokens of the document do
+    unsigned long long generation = 0;
+};
+
 struct output_line
 {
     int level;
@@ -140,5 +149,12 @@ struct output_line
     bool operator==(const output_line&) const noexcept = default;
 };
 
+struct output_page
+{
+    std::span<const output_line> lines;
+    // changes whenever the output of the document does, pages of different generations do not fit together
+    unsigned long long generation = 0;
+};
+
 } // namespace hlasm_plugin::parser_library
 #endif // !HLASMPLUGIN_PARSERLIBRARY_PROTOCOL_H
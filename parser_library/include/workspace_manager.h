@@ -20,8 +20,12 @@
 // It implements LSP requests and notifications and is used by the language server.
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <span>
+#include <string>
+#include <string_view>
 #include <utility>
 
 #include "branch_info.h"
@@ -83,6 +87,31 @@ protected:
     ~progress_notification_consumer() = default;
 };
 
+// notified when the idle_handler should be called again
+class idle_handler_wakeup
+{
+public:
+    // background work has progressed, may be called from other threads
+    virtual void wake_up() = 0;
+    // deferred work becomes ready after the delay, called from the idle_handler
+    virtual void wake_up_after(std::chrono::milliseconds delay) = 0;
+
+protected:
+    ~idle_handler_wakeup() = default;
+};
+
+// keeps the cross-program index of the workspace between sessions
+class workspace_index_storage
+{
+public:
+    virtual std::optional<std::string> load() = 0;
+    // called once the analyses are finished and the index has changed, throttled by index_store_interval
+    virtual void store(std::string_view data) = 0;
+
+protected:
+    ~workspace_index_storage() = default;
+};
+
 enum class fs_change_type
 {
     invalid = 0,
@@ -142,7 +171,7 @@ public:
         workspace_manager_response<std::span<const completion_item>> resp) = 0;
 
     virtual void semantic_tokens(
-        std::string_view document_uri, workspace_manager_response<std::span<const token_info>> resp) = 0;
+        std::string_view document_uri, workspace_manager_response<const semantic_tokens_info&> resp) = 0;
     virtual void document_symbol(
         std::string_view document_uri, workspace_manager_response<std::span<const document_symbol_item>> resp) = 0;
 
@@ -179,8 +208,11 @@ public:
     virtual void folding(
         std::string_view document_uri, workspace_manager_response<std::span<const folding_range>> resp) = 0;
 
-    virtual void retrieve_output(
-        std::string_view document_uri, workspace_manager_response<std::span<const output_line>> resp) = 0;
+    // at most count output lines starting with the first one, to be retrieved in pages
+    virtual void retrieve_output(std::string_view document_uri,
+        size_t first,
+        size_t count,
+        workspace_manager_response<const output_page&> resp) = 0;
 
     virtual void change_implicit_group_base(std::string_view uri) = 0;
 };
@@ -190,6 +222,22 @@ struct workspace_manager_args
     workspace_manager_external_file_requests* external_requests = nullptr;
     const utils::text_convertor* text_conversion = nullptr;
     bool vscode_extensions = false;
+    // maximum number of local directories listed concurrently, zero lists them synchronously
+    unsigned io_concurrency = 0;
+    // number of additional threads that check the operands of large programs, zero checks them on the analysis thread
+    unsigned check_concurrency = 0;
+    idle_handler_wakeup* wakeup = nullptr;
+    // edits are coalesced for as long as the last analysis of the affected file took, within these limits,
+    // requires wakeup, zero maximum disables the coalescing
+    std::chrono::milliseconds min_reparse_delay = std::chrono::milliseconds(0);
+    std::chrono::milliseconds max_reparse_delay = std::chrono::milliseconds(0);
+    workspace_index_storage* index_storage = nullptr;
+    // the index is stored at most this often, and once more when the workspace manager is destroyed,
+    // requires wakeup to store the last changes without further activity
+    std::chrono::milliseconds index_store_interval = std::chrono::seconds(30);
+    // programs reuse the macros and copy members parsed for the programs closed before them,
+    // intended for batch analyses, the identifiers of all programs are kept until the workspace manager is destroyed
+    bool share_member_caches = false;
 };
 
 workspace_manager* create_workspace_manager_impl(const workspace_manager_args& args);
@@ -16,14 +16,17 @@
 
 #include "context/hlasm_context.h"
 #include "context/id_storage.h"
+#include "context/statement_arena.h"
 #include "diagnosable_ctx.h"
 #include "empty_parse_lib_provider.h"
 #include "lsp/lsp_context.h"
+#include "lsp_detail_provider.h"
 #include "parse_lib_provider.h"
 #include "processing/opencode_provider.h"
 #include "processing/preprocessor.h"
 #include "processing/processing_manager.h"
 #include "semantics/source_info_processor.h"
+#include "utils/scope_exit.h"
 #include "utils/task.h"
 
 namespace hlasm_plugin::parser_library {
@@ -115,7 +118,8 @@ std::unique_ptr<processing::preprocessor> analyzer_options::get_preprocessor(pro
 struct analyzer::impl final
 {
     impl(std::string_view text, analyzer_options&& opts)
-        : diag_ctx(opts.get_hlasm_context(), opts.diag_limit.limit)
+        : dependency_arena(opts.dep_name.empty() ? nullptr : std::make_shared<context::statement_arena>())
+        , diag_ctx(opts.get_hlasm_context(), opts.diag_limit.limit)
         , ctx(std::move(opts.get_context()))
         , src_proc(opts.collect_hl_info == collect_highlighting_info::yes)
         , field_parser(*ctx.hlasm_ctx)
@@ -128,8 +132,7 @@ struct analyzer::impl final
                    diag_ctx,
                    opts.get_preprocessor(
                        std::bind_front(&parse_lib_provider::get_library, &opts.get_lib_provider()), diag_ctx, src_proc),
-                   opts.parsing_opencode == file_is_opencode::yes ? processing::opencode_provider_options { true, 10 }
-                                                                  : processing::opencode_provider_options {},
+                   provider_options(opts),
                    opts.vf_monitor,
                    vf_handles),
               ctx,
@@ -141,9 +144,29 @@ struct analyzer::impl final
               field_parser,
               std::move(opts.fade_messages),
               opts.output,
+              opts.lsp_details,
+              opts.check_pool.pool,
               diag_ctx)
     {}
 
+    static processing::opencode_provider_options provider_options(const analyzer_options& opts)
+    {
+        if (opts.parsing_opencode == file_is_opencode::yes)
+            return { .ictl_allowed = true, .process_remaining = 10 };
+
+        // macro members without full lsp details do not need the variable symbols of the deferred statements
+        return {
+            .ictl_allowed = false,
+            .process_remaining = 0,
+            .capture_macro_operands = opts.dep_kind == processing::processing_kind::MACRO
+                && opts.collect_hl_info == collect_highlighting_info::no && opts.lsp_details
+                && !opts.lsp_details->full_lsp_details(opts.file_loc),
+        };
+    }
+
+    // library members are allocated separately, so that cached definitions do not retain the caller's arena
+    std::shared_ptr<context::statement_arena> dependency_arena;
+
     diagnosable_ctx diag_ctx;
 
     analyzing_context ctx;
@@ -182,6 +205,12 @@ void analyzer::analyze() { co_analyze().run(); }
 
 hlasm_plugin::utils::task analyzer::co_analyze() &
 {
+    auto& hlasm_ctx = *m_impl->ctx.hlasm_ctx;
+    auto caller_arena = m_impl->dependency_arena ? hlasm_ctx.exchange_statement_arena(m_impl->dependency_arena)
+                                                 : hlasm_ctx.current_statement_arena();
+    utils::scope_exit restore_arena(
+        [&hlasm_ctx, &caller_arena]() noexcept { hlasm_ctx.exchange_statement_arena(std::move(caller_arena)); });
+
     co_await m_impl->mngr.co_step();
 
     m_impl->src_proc.finish();
@@ -29,12 +29,22 @@ diagnostic_collector::diagnostic_collector(diagnosable_ctx* diagnoser)
     : diagnoser_(diagnoser)
 {}
 
+diagnostic_collector::diagnostic_collector(std::vector<diagnostic_op>& buffer)
+    : diagnoser_(nullptr)
+    , buffer_(&buffer)
+{}
+
 diagnostic_collector::diagnostic_collector()
     : diagnoser_(nullptr)
 {}
 
 void diagnostic_collector::operator()(diagnostic_op diagnostic) const
 {
+    if (buffer_)
+    {
+        buffer_->push_back(std::move(diagnostic));
+        return;
+    }
     if (!diagnoser_)
         return;
     diagnoser_->add_raw_diagnostic(add_stack_details(std::move(diagnostic), get_location_stack()));
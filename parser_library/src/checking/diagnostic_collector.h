@@ -15,6 +15,8 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_DIAGNOSTIC_COLLECTOR_H
 #define HLASMPLUGIN_PARSERLIBRARY_DIAGNOSTIC_COLLECTOR_H
 
+#include <vector>
+
 #include "context/source_context.h"
 #include "diagnostic_op.h"
 
@@ -28,6 +30,7 @@ class diagnostic_collector
 {
     diagnosable_ctx* diagnoser_;
     context::processing_stack_t location_stack_;
+    std::vector<diagnostic_op>* buffer_ = nullptr;
 
 public:
     // constructor with explicit location stack
@@ -38,6 +41,10 @@ public:
     // used for default statement checking
     explicit diagnostic_collector(diagnosable_ctx* diagnoser);
 
+    // constructor for collector that stores diagnostics without the location details
+    // used when postponed statements are checked outside of the analysis thread
+    explicit diagnostic_collector(std::vector<diagnostic_op>& buffer);
+
     // constructor for collector that silences diagnostics
     diagnostic_collector();
 
@@ -21,6 +21,7 @@
 #include <ranges>
 
 #include "context/id_storage.h"
+#include "context/statement_arena.h"
 #include "context/well_known.h"
 #include "diagnostic_tools.h"
 #include "ebcdic_encoding.h"
@@ -351,6 +352,7 @@ hlasm_context::hlasm_context(
     , m_usings(std::make_unique<using_collection>())
     , m_active_usings(1, m_usings->remove_all())
     , m_statements_remaining(asm_options_.statement_count_limit)
+    , m_statement_arena(std::make_shared<statement_arena>())
     , ord_ctx(*this)
 {
     scope_stack_.emplace_back().time = utils::timestamp::now().value_or(utils::timestamp(1900, 1, 1));
@@ -448,6 +450,27 @@ processing_stack_t hlasm_context::processing_stack()
     }
 }
 
+size_t hlasm_context::processing_stack_depth() const
+{
+    const auto source_depth = [](const source_context& source) { return 1 + source.copy_stack.size(); };
+
+    if (scope_stack_.size() <= 1)
+    {
+        size_t depth = 0;
+        for (const auto& scope : source_stack_)
+            depth += source_depth(scope);
+        return depth;
+    }
+    else
+    {
+        const auto& scope = scope_stack_.back();
+        size_t depth = scope.stack.depth() + scope.this_macro->get_current_copy_nest().size();
+        for (const auto& source : source_stack_ | std::views::drop(1))
+            depth += source_depth(source);
+        return depth;
+    }
+}
+
 processing_stack_details_t hlasm_context::processing_stack_details()
 {
     const auto stack = processing_stack();
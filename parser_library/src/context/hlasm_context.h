@@ -22,6 +22,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "code_scope.h"
@@ -48,6 +49,7 @@ class using_collection;
 namespace hlasm_plugin::parser_library::context {
 
 class id_storage;
+class statement_arena;
 
 class system_variable_map
 {
@@ -136,6 +138,9 @@ private:
 
     long long m_statements_remaining;
 
+    // arena for statements with the lifetime of the current analysis
+    std::shared_ptr<statement_arena> m_statement_arena;
+
     processing_frame_tree m_stack_tree;
 
     std::string m_title_name;
@@ -188,6 +193,8 @@ public:
     // gets stack of locations of all currently processed files
     processing_stack_t processing_stack();
     processing_stack_details_t processing_stack_details();
+    // depth of processing_stack() without materializing it
+    size_t processing_stack_depth() const;
     position current_statement_position(bool consider_macros = true);
     location current_statement_location(bool consider_macros = true);
     const utils::resource::resource_location& current_statement_source(bool consider_macros = true);
@@ -334,6 +341,13 @@ public:
 
     bool next_statement() { return --m_statements_remaining >= 0; }
 
+    const std::shared_ptr<statement_arena>& current_statement_arena() const noexcept { return m_statement_arena; }
+    // replaces the arena used for newly created statements, returns the previous one
+    std::shared_ptr<statement_arena> exchange_statement_arena(std::shared_ptr<statement_arena> arena) noexcept
+    {
+        return std::exchange(m_statement_arena, std::move(arena));
+    }
+
     const opcode_t* find_opcode_mnemo(id_index name,
         opcode_generation gen = opcode_generation::current,
         context::id_index* ext_suggestion = nullptr) const;
@@ -14,6 +14,8 @@
 
 #include "id_storage.h"
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 
 #include "utils/string_operations.h"
@@ -27,6 +29,13 @@ id_index id_storage::small_id(std::string_view value)
     return id_index(std::string_view(buf, end - buf));
 }
 
+std::string_view id_storage::upper_case(std::string_view value, char (&buf)[lookup_buffer_size])
+{
+    assert(value.size() <= lookup_buffer_size);
+    const auto [_, end] = std::ranges::transform(value, buf, [](unsigned char c) { return utils::upper_cased[c]; });
+    return std::string_view(buf, end - buf);
+}
+
 size_t id_storage::size() const { return lit_.size(); }
 
 bool id_storage::empty() const { return lit_.empty(); }
@@ -36,7 +45,15 @@ std::optional<id_index> id_storage::find(std::string_view value) const
     if (value.size() < id_index::buffer_size)
         return small_id(value);
 
-    if (auto tmp = lit_.find(utils::to_upper_copy(std::string(value))); tmp != lit_.end())
+    if (value.size() > lookup_buffer_size)
+    {
+        if (auto tmp = lit_.find(utils::to_upper_copy(std::string(value))); tmp != lit_.end())
+            return id_index(std::to_address(tmp));
+        return std::nullopt;
+    }
+
+    char buf[lookup_buffer_size];
+    if (auto tmp = lit_.find(upper_case(value, buf)); tmp != lit_.end())
         return id_index(std::to_address(tmp));
     else
         return std::nullopt;
@@ -47,7 +64,16 @@ id_index id_storage::add(std::string_view value)
     if (value.size() < id_index::buffer_size)
         return small_id(value);
 
-    return add(std::string(value));
+    if (value.size() > lookup_buffer_size)
+        return add(std::string(value));
+
+    // only identifiers seen for the first time are copied
+    char buf[lookup_buffer_size];
+    const auto upper = upper_case(value, buf);
+    if (auto tmp = lit_.find(upper); tmp != lit_.end())
+        return id_index(std::to_address(tmp));
+
+    return id_index(std::to_address(lit_.emplace(upper).first));
 }
 
 id_index id_storage::add(std::string&& value)
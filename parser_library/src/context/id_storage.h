@@ -15,20 +15,26 @@
 #ifndef CONTEXT_LITERAL_STORAGE_H
 #define CONTEXT_LITERAL_STORAGE_H
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <unordered_set>
 
 #include "id_index.h"
+#include "utils/general_hashers.h"
 
 namespace hlasm_plugin::parser_library::context {
 // storage for identifiers
 // changes strings of identifiers to indexes of this storage class for easier and unified work
 class id_storage
 {
-    std::unordered_set<std::string> lit_;
+    std::unordered_set<std::string, utils::hashers::string_hasher, std::equal_to<>> lit_;
+
+    // identifiers up to this length are upper-cased on the stack when looked up
+    static constexpr size_t lookup_buffer_size = 64;
 
     static id_index small_id(std::string_view value);
+    static std::string_view upper_case(std::string_view value, char (&buf)[lookup_buffer_size]);
 
 public:
     size_t size() const;
@@ -62,6 +62,8 @@ class ordinary_assembly_context
     std::unordered_map<id_index, std::variant<symbol, using_label_tag, macro_label_tag>> symbols_;
     // list of lookaheaded symbols
     std::unordered_map<id_index, symbol> symbol_refs_;
+    // symbols named by the ENTRY instruction
+    std::vector<id_index> entry_points_;
     // regenerate symbol addresses
     std::vector<symbol*> regenerate_symbols;
 
@@ -90,6 +92,10 @@ public:
     // access symbols
     const auto& symbols() const { return symbols_; }
 
+    // access entry points
+    const auto& entry_points() const { return entry_points_; }
+    void add_entry_point(id_index name) { entry_points_.push_back(name); }
+
     // access symbol dependency table
     symbol_dependency_tables& symbol_dependencies() { return *m_symbol_dependencies; }
 
@@ -97,6 +97,7 @@ class processing_frame_tree
     struct processing_frame_node
     {
         const processing_frame_node* m_parent;
+        size_t m_depth;
 
         processing_frame frame;
 
@@ -108,10 +109,12 @@ class processing_frame_tree
             id_index member,
             file_processing_type proc_type)
             : m_parent(parent)
+            , m_depth(parent->m_depth + 1)
             , frame(pos, resource_loc, member, proc_type)
         {}
         explicit processing_frame_node()
             : m_parent(nullptr)
+            , m_depth(0)
             , frame({}, utils::resource::resource_location(), id_index(), file_processing_type::NONE)
         {}
     };
@@ -147,6 +150,8 @@ public:
 
         const processing_frame& frame() const { return m_node->frame; }
         node_pointer parent() const { return node_pointer(m_node->m_parent); }
+        // number of frames on the stack
+        size_t depth() const noexcept { return m_node ? m_node->m_depth : 0; }
 
         std::vector<processing_frame> to_vector() const;
         void to_vector(std::vector<processing_frame>&) const;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "statement_arena.h"
+
+#include <cstdint>
+#include <new>
+
+namespace hlasm_plugin::parser_library::context {
+
+namespace {
+constexpr std::size_t header_size = arena_allocated::object_alignment;
+constexpr auto heap_align_val = std::align_val_t(arena_allocated::heap_alignment);
+// the default allocation function aligns the blocks that are large enough to hold an object with that alignment
+constexpr bool default_new_aligned(std::size_t bytes) noexcept
+{
+    return __STDCPP_DEFAULT_NEW_ALIGNMENT__ >= arena_allocated::heap_alignment
+        && bytes >= arena_allocated::heap_alignment;
+}
+} // namespace
+
+void* arena_allocated::operator new(std::size_t bytes)
+{
+    if (default_new_aligned(bytes))
+        return ::operator new(bytes);
+    else
+        return ::operator new(bytes, heap_align_val);
+}
+
+void* arena_allocated::operator new(std::size_t bytes, statement_arena& arena)
+{
+    void* p = arena.allocate(header_size + bytes, heap_alignment);
+    new (p) statement_arena*(&arena);
+
+    return static_cast<std::byte*>(p) + header_size;
+}
+
+void arena_allocated::operator delete(void* p, std::size_t bytes) noexcept
+{
+    if (!p)
+        return;
+
+    if (reinterpret_cast<std::uintptr_t>(p) % heap_alignment == 0)
+    {
+        if (default_new_aligned(bytes))
+            ::operator delete(p, bytes);
+        else
+            ::operator delete(p, bytes, heap_align_val);
+        return;
+    }
+
+    void* start = static_cast<std::byte*>(p) - header_size;
+    (*static_cast<statement_arena**>(start))->deallocate(start, header_size + bytes, heap_alignment);
+}
+
+} // namespace hlasm_plugin::parser_library::context
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_STATEMENT_ARENA_H
+#define CONTEXT_STATEMENT_ARENA_H
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace hlasm_plugin::parser_library::context {
+
+// memory pool for objects with analysis lifetime (statements, operands and expressions produced by the parser and
+// the statement providers)
+// blocks are recycled within the pool and returned to the system all at once when the last object is released
+// the pool is not synchronized, objects must be created and released on the thread that performs the analysis
+class statement_arena
+{
+    std::pmr::unsynchronized_pool_resource m_pool;
+    std::size_t m_allocations = 0;
+    std::size_t m_bytes = 0;
+
+public:
+    statement_arena() = default;
+    statement_arena(const statement_arena&) = delete;
+    statement_arena& operator=(const statement_arena&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        ++m_allocations;
+        m_bytes += bytes;
+        return m_pool.allocate(bytes, alignment);
+    }
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept
+    {
+        m_pool.deallocate(p, bytes, alignment);
+    }
+
+    // total number of allocations served by the arena
+    std::size_t allocations() const noexcept { return m_allocations; }
+    // total number of bytes requested from the arena
+    std::size_t bytes_allocated() const noexcept { return m_bytes; }
+};
+
+// allocator keeps the arena alive as long as any object allocated by it exists
+template<typename T>
+class statement_arena_allocator
+{
+    template<typename U>
+    friend class statement_arena_allocator;
+
+    std::shared_ptr<statement_arena> m_arena;
+
+public:
+    using value_type = T;
+
+    explicit statement_arena_allocator(std::shared_ptr<statement_arena> arena) noexcept
+        : m_arena(std::move(arena))
+    {}
+    template<typename U>
+    statement_arena_allocator(const statement_arena_allocator<U>& other) noexcept
+        : m_arena(other.m_arena)
+    {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T* p, std::size_t n) noexcept { m_arena->deallocate(p, n * sizeof(T), alignof(T)); }
+
+    template<typename U>
+    bool operator==(const statement_arena_allocator<U>& other) const noexcept
+    {
+        return m_arena == other.m_arena;
+    }
+};
+
+// allocates the object in the arena when provided, falls back to the general heap otherwise
+template<typename T, typename... Args>
+std::shared_ptr<T> make_arena_shared(const std::shared_ptr<statement_arena>& arena, Args&&... args)
+{
+    if (!arena)
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    return std::allocate_shared<T>(statement_arena_allocator<T>(arena), std::forward<Args>(args)...);
+}
+
+// base for objects owned through std::unique_ptr (operands, expression nodes)
+// objects created with an arena are placed in it and refer to it by a plain pointer, the owner of the object
+// (a statement or a literal allocated in the same arena) is responsible for keeping the arena alive
+// all the other objects are allocated on the general heap without any overhead
+class arena_allocated
+{
+public:
+    // objects in the arena are preceded by the pointer to it, they are never aligned to heap_alignment
+    // while the heap objects always are, so the placement tells the two apart on deallocation
+    static constexpr std::size_t object_alignment = sizeof(statement_arena*) < alignof(long long)
+        ? alignof(long long)
+        : sizeof(statement_arena*);
+    static constexpr std::size_t heap_alignment = 2 * object_alignment;
+
+    static void* operator new(std::size_t bytes);
+    static void* operator new(std::size_t bytes, statement_arena& arena);
+    static void operator delete(void* p, std::size_t bytes) noexcept;
+    // the block is reclaimed together with the arena when the constructor throws
+    static void operator delete(void*, statement_arena&) noexcept {}
+};
+
+// allocates the object in the arena when provided, falls back to the general heap otherwise
+template<std::derived_from<arena_allocated> T, typename... Args>
+std::unique_ptr<T> make_arena_unique(statement_arena* arena, Args&&... args)
+{
+    static_assert(alignof(T) <= arena_allocated::object_alignment);
+    if (!arena)
+        return std::make_unique<T>(std::forward<Args>(args)...);
+    return std::unique_ptr<T>(new (*arena) T(std::forward<Args>(args)...));
+}
+
+} // namespace hlasm_plugin::parser_library::context
+
+#endif
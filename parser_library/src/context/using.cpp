@@ -15,6 +15,7 @@
 #include "using.h"
 
 #include <bitset>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <span>
@@ -28,6 +29,7 @@
 #include "expressions/mach_expression.h"
 #include "ordinary_assembly/dependable.h"
 #include "ordinary_assembly/ordinary_assembly_dependency_solver.h"
+#include "utils/general_hashers.h"
 #include "utils/similar.h"
 
 constexpr std::string_view USING = "USING";
@@ -64,7 +66,7 @@ void using_collection::using_entry::compute_context_correction(
     if (!u.label.empty())
         compute_context_drop(u.label); // not diagnosed, but maybe we should warn
 
-    context.m_state.emplace_back(using_context::entry { u.label, u.owner, u.begin, u.length, u.reg_set, u.reg_offset });
+    context.add(using_context::entry { u.label, u.owner, u.begin, u.length, u.reg_set, u.reg_offset, 0 });
 }
 
 std::string_view convert_diag(const id_index& id) // lifetime! id needs to outlive the return value!
@@ -87,27 +89,272 @@ void using_collection::using_entry::compute_context_correction(
             drop);
 }
 
-size_t using_collection::using_entry::compute_context_drop(id_index d)
+size_t using_collection::using_entry::compute_context_drop(id_index d) { return context.drop(d); }
+
+size_t using_collection::using_entry::compute_context_drop(register_t d) { return context.drop(d); }
+
+struct using_collection::using_context::node
 {
-    return std::erase_if(context.m_state, [d](const auto& e) { return e.label == d; });
+    // registers and unmapped entries present in a group of entries
+    struct summary
+    {
+        std::bitset<reg_set_size> regs;
+        bool unmapped = false;
+
+        summary& operator|=(const summary& o)
+        {
+            regs |= o.regs;
+            unmapped |= o.unmapped;
+            return *this;
+        }
+    };
+
+    id_index label;
+    const section* owner;
+    size_t priority;
+    node_ptr left;
+    node_ptr right;
+    std::shared_ptr<const std::vector<entry>> entries;
+    summary own;
+    summary subtree;
+
+    static summary summarize(const std::vector<entry>& entries)
+    {
+        summary result;
+        for (const auto& e : entries)
+        {
+            result.unmapped |= e.regs == invalid_register_set;
+            for (auto r : e.regs)
+                if (r != invalid_register)
+                    result.regs.set(r);
+        }
+        return result;
+    }
+
+    void update_subtree()
+    {
+        subtree = own;
+        if (left)
+            subtree |= left->subtree;
+        if (right)
+            subtree |= right->subtree;
+    }
+};
+
+namespace {
+bool key_less(id_index l_label, const section* l_owner, id_index r_label, const section* r_owner)
+{
+    if (l_label != r_label)
+        return l_label < r_label;
+    return std::less<const section*>()(l_owner, r_owner);
 }
+} // namespace
 
-size_t using_collection::using_entry::compute_context_drop(register_t d)
+auto using_collection::using_context::merge(const node_ptr& l, const node_ptr& r) -> node_ptr
 {
-    size_t invalidated = 0;
-    for (auto& e : context.m_state)
+    if (!l)
+        return r;
+    if (!r)
+        return l;
+
+    if (l->priority >= r->priority)
+    {
+        auto result = std::make_shared<node>(*l);
+        result->right = merge(l->right, r);
+        result->update_subtree();
+        return result;
+    }
+    else
+    {
+        auto result = std::make_shared<node>(*r);
+        result->left = merge(l, r->left);
+        result->update_subtree();
+        return result;
+    }
+}
+
+template<typename Pred>
+auto using_collection::using_context::split(const node_ptr& t, const Pred& goes_left) -> std::pair<node_ptr, node_ptr>
+{
+    if (!t)
+        return {};
+
+    if (goes_left(*t))
+    {
+        auto [l, r] = split(t->right, goes_left);
+        auto result = std::make_shared<node>(*t);
+        result->right = std::move(l);
+        result->update_subtree();
+        return { std::move(result), std::move(r) };
+    }
+    else
     {
-        if (e.label.empty())
+        auto [l, r] = split(t->left, goes_left);
+        auto result = std::make_shared<node>(*t);
+        result->left = std::move(r);
+        result->update_subtree();
+        return { std::move(l), std::move(result) };
+    }
+}
+
+auto using_collection::using_context::make_node(id_index label, const section* owner, std::vector<entry> entries)
+    -> node_ptr
+{
+    const auto own = node::summarize(entries);
+
+    // deterministic priorities keep the shape independent of the order of operations
+    return std::make_shared<const node>(node {
+        label,
+        owner,
+        utils::hashers::hash_combine(label.hash(), std::hash<const section*>()(owner)),
+        nullptr,
+        nullptr,
+        std::make_shared<const std::vector<entry>>(std::move(entries)),
+        own,
+        own,
+    });
+}
+
+template<typename F>
+void using_collection::using_context::for_each_node(const node* n, const F& f)
+{
+    if (!n)
+        return;
+    for_each_node(n->left.get(), f);
+    f(*n);
+    for_each_node(n->right.get(), f);
+}
+
+template<typename Pred, typename F>
+auto using_collection::using_context::transform(const node_ptr& n, const Pred& affected, const F& f) -> node_ptr
+{
+    if (!n || !affected(n->subtree))
+        return n;
+
+    auto left = transform(n->left, affected, f);
+    auto right = transform(n->right, affected, f);
+
+    auto result = std::make_shared<node>(*n);
+    if (affected(n->own))
+    {
+        auto entries = f(*n->entries);
+        if (entries.empty())
+            return merge(left, right);
+        result->own = node::summarize(entries);
+        result->entries = std::make_shared<const std::vector<entry>>(std::move(entries));
+    }
+    result->left = std::move(left);
+    result->right = std::move(right);
+    result->update_subtree();
+    return result;
+}
+
+auto using_collection::using_context::find(id_index label, const section* owner) const -> const std::vector<entry>*
+{
+    for (const node* n = m_root.get(); n;)
+    {
+        if (key_less(label, owner, n->label, n->owner))
+            n = n->left.get();
+        else if (key_less(n->label, n->owner, label, owner))
+            n = n->right.get();
+        else
+            return n->entries.get();
+    }
+    return nullptr;
+}
+
+void using_collection::using_context::add(entry e)
+{
+    e.order = m_next_order++;
+    if (e.regs == invalid_register_set)
+        ++m_unmapped;
+
+    auto [l, rest] = split(m_root, [&e](const node& n) { return key_less(n.label, n.owner, e.label, e.owner); });
+    auto [same, r] = split(rest, [&e](const node& n) { return !key_less(e.label, e.owner, n.label, n.owner); });
+
+    std::vector<entry> entries;
+    if (same)
+        entries = *same->entries;
+    entries.push_back(e);
+
+    m_root = merge(merge(l, make_node(e.label, e.owner, std::move(entries))), r);
+}
+
+size_t using_collection::using_context::drop(id_index label)
+{
+    size_t dropped = 0;
+    const auto count = [this, &dropped](const std::vector<entry>& entries) {
+        for (const auto& e : entries)
         {
-            invalidated += std::ranges::count(e.regs, d);
-            std::ranges::replace(e.regs, d, invalid_register);
+            ++dropped;
+            if (e.regs == invalid_register_set)
+                --m_unmapped;
         }
-    }
-    std::erase_if(context.m_state, [](const auto& e) { return e.regs == invalid_register_set; });
+    };
+
+    auto [l, rest] = split(m_root, [label](const node& n) { return n.label < label; });
+    auto [same, r] = split(rest, [label](const node& n) { return n.label <= label; });
+    for_each_node(same.get(), [&count](const node& n) { count(*n.entries); });
+
+    if (dropped)
+        m_root = merge(l, r);
+
+    return dropped;
+}
+
+size_t using_collection::using_context::drop(register_t reg)
+{
+    size_t invalidated = 0;
+    const auto invalidate = [reg, &invalidated](const std::vector<entry>& entries) {
+        std::vector<entry> result;
+        for (auto e : entries)
+        {
+            invalidated += std::ranges::count(e.regs, reg);
+            std::ranges::replace(e.regs, reg, invalid_register);
+            if (e.regs != invalid_register_set)
+                result.push_back(e);
+        }
+        return result;
+    };
+    const auto remove_unmapped = [](const std::vector<entry>& entries) {
+        std::vector<entry> result;
+        std::ranges::copy_if(entries, std::back_inserter(result), [](const auto& e) {
+            return e.regs != invalid_register_set;
+        });
+        return result;
+    };
+
+    // only ordinary usings are affected, labeled ones are dropped by their label
+    auto [l, rest] = split(m_root, [](const node& n) { return n.label < id_index(); });
+    auto [ordinary, labeled] = split(rest, [](const node& n) { return n.label <= id_index(); });
+
+    // only the paths to the groups with the register or with unmapped entries are copied
+    ordinary = transform(
+        ordinary, [reg](const node::summary& s) { return s.regs.test(reg) || s.unmapped; }, invalidate);
+    if (m_unmapped)
+        labeled = transform(labeled, [](const node::summary& s) { return s.unmapped; }, remove_unmapped);
+
+    auto result = merge(merge(l, ordinary), labeled);
+
+    if (invalidated || m_unmapped)
+        m_root = std::move(result);
+    m_unmapped = 0;
 
     return invalidated;
 }
 
+auto using_collection::using_context::entries() const -> std::vector<const entry*>
+{
+    std::vector<const entry*> result;
+    for_each_node(m_root.get(), [&result](const node& n) {
+        for (const auto& e : *n.entries)
+            result.push_back(&e);
+    });
+    std::ranges::sort(result, {}, &entry::order);
+
+    return result;
+}
+
 auto using_collection::using_drop_definition::abs_or_reloc(const using_collection& coll,
     index_t<mach_expression> e,
     bool abs_is_register) -> std::pair<std::optional<qualified_address>, range>
@@ -443,9 +690,7 @@ bool hlasm_plugin::parser_library::context::using_collection::is_label_mapping_s
     if (!context_id)
         return false;
 
-    const auto& state = get(context_id).context.m_state;
-
-    return std::ranges::any_of(state, [label, owner](const auto& s) { return s.label == label && s.owner == owner; });
+    return get(context_id).context.find(label, owner) != nullptr;
 }
 
 template</* std::integral */ typename R, /* std::integral */ typename T>
@@ -501,14 +746,14 @@ auto using_collection::using_context::evaluate(id_index label,
                 return zero_reg;
             }(),
             0,
+            0,
         };
         (offset >= 0 ? positive : negative) = result_candidate { &zero_entry, 0, std::abs(offset), offset, 0 };
     }
 
-    for (const auto& s : m_state)
+    const auto* const candidates = find(label, owner);
+    for (const auto& s : candidates ? std::span(*candidates) : std::span<const entry>())
     {
-        if (label != s.label || owner != s.owner)
-            continue;
         auto next_dist = (offset - s.offset) + s.reg_offset;
         const bool fits_limit = next_dist < s.length;
         for (const auto& reg : s.regs)
@@ -601,13 +846,13 @@ std::vector<using_context_description> using_collection::describe(index_t<using_
 
     std::vector<using_context_description> result;
 
-    for (const auto& u : get(context_id).context.m_state)
-        result.emplace_back(u.label,
-            u.owner ? std::optional(u.owner->name) : std::nullopt,
-            u.offset,
-            (unsigned long)u.length,
-            u.reg_offset,
-            std::vector<using_collection::register_t>(u.regs.begin(), std::ranges::find(u.regs, invalid_register)));
+    for (const auto* u : get(context_id).context.entries())
+        result.emplace_back(u->label,
+            u->owner ? std::optional(u->owner->name) : std::nullopt,
+            u->offset,
+            (unsigned long)u->length,
+            u->reg_offset,
+            std::vector<using_collection::register_t>(u->regs.begin(), std::ranges::find(u->regs, invalid_register)));
 
     return result;
 }
@@ -23,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "id_index.h"
@@ -222,6 +223,7 @@ private:
         friend bool operator==(const context_evaluate_result&, const context_evaluate_result&) = default;
     };
 
+    // immutable once created, contexts derived from each other share the unchanged parts
     class using_context
     {
         struct entry
@@ -232,9 +234,36 @@ private:
             offset_t length;
             register_set_t regs;
             offset_t reg_offset;
+            size_t order;
         };
 
-        std::vector<entry> m_state;
+        // treap of the active entries grouped by (label, owner)
+        struct node;
+        using node_ptr = std::shared_ptr<const node>;
+
+        node_ptr m_root;
+        size_t m_next_order = 0;
+        // entries without any register are discarded by the next DROP of a register
+        size_t m_unmapped = 0;
+
+        static node_ptr merge(const node_ptr& l, const node_ptr& r);
+        template<typename Pred>
+        static std::pair<node_ptr, node_ptr> split(const node_ptr& t, const Pred& goes_left);
+        static node_ptr make_node(id_index label, const section* owner, std::vector<entry> entries);
+        template<typename F>
+        static void for_each_node(const node* n, const F& f);
+
+        // path copy of the subtree with transformed entries of the affected groups, empty groups are removed
+        template<typename Pred, typename F>
+        static node_ptr transform(const node_ptr& n, const Pred& affected, const F& f);
+
+        const std::vector<entry>* find(id_index label, const section* owner) const;
+
+        void add(entry e);
+        size_t drop(id_index label);
+        size_t drop(register_t reg);
+
+        std::vector<const entry*> entries() const;
 
         context_evaluate_result evaluate(id_index label,
             const section* owner,
@@ -16,7 +16,9 @@
 
 #include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -87,8 +89,9 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
 
     // Specifies whether the debugger stops on the next statement call.
     bool stop_on_next_stmt_ = false;
+    // Stops once the processing stack is not deeper than the limit.
     bool stop_on_stack_changes_ = false;
-    std::pair<context::processing_stack_t, std::optional<utils::resource::resource_location>> stop_on_stack_condition_;
+    size_t stop_on_stack_depth_ = 0;
 
     // True, if disconnect request was received
     bool disconnected_ = false;
@@ -108,9 +111,118 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
     size_t next_var_ref_ = 1;
     context::processing_stack_details_t proc_stack_;
 
-    std::unordered_map<utils::resource::resource_location, std::vector<breakpoint>> breakpoints_;
+    class hit_condition
+    {
+        enum class kind
+        {
+            none,
+            eq,
+            gt,
+            ge,
+            lt,
+            le,
+            mod,
+        };
+        kind k = kind::none;
+        size_t value = 0;
+
+    public:
+        hit_condition() = default;
+        explicit hit_condition(std::string_view text)
+        {
+            utils::trim_left(text);
+            utils::trim_right(text);
+            if (text.empty())
+                return;
+
+            static constexpr std::pair<std::string_view, kind> prefixes[] = {
+                { "==", kind::eq },
+                { ">=", kind::ge },
+                { "<=", kind::le },
+                { "=", kind::eq },
+                { ">", kind::gt },
+                { "<", kind::lt },
+                { "%", kind::mod },
+            };
+            // plain number stops on the n-th hit and all the following ones
+            kind parsed = kind::ge;
+            for (const auto& [prefix, prefix_kind] : prefixes)
+            {
+                if (!text.starts_with(prefix))
+                    continue;
+                parsed = prefix_kind;
+                text.remove_prefix(prefix.size());
+                utils::trim_left(text);
+                break;
+            }
+
+            size_t v = 0;
+            if (const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), v);
+                ec != std::errc() || ptr != text.data() + text.size())
+                return;
+            if (parsed == kind::mod && v == 0)
+                return;
+
+            k = parsed;
+            value = v;
+        }
+
+        bool satisfied(size_t hits) const noexcept
+        {
+            switch (k)
+            {
+                case kind::none:
+                    return true;
+                case kind::eq:
+                    return hits == value;
+                case kind::gt:
+                    return hits > value;
+                case kind::ge:
+                    return hits >= value;
+                case kind::lt:
+                    return hits < value;
+                case kind::le:
+                    return hits <= value;
+                case kind::mod:
+                    return hits % value == 0;
+            }
+            return true;
+        }
+    };
+
+    struct breakpoint_state
+    {
+        hit_condition hit;
+        size_t hits = 0;
+        // condition is parsed on the first use, it requires the context of the running analysis
+        bool condition_parsed = false;
+        semantics::operand_ptr condition;
+    };
+
+    struct file_breakpoints
+    {
+        std::vector<breakpoint> bps;
+        std::vector<breakpoint_state> states;
+        // sorted unique lines with at least one breakpoint
+        std::vector<size_t> lines;
+
+        bool any_in(size_t first, size_t last) const noexcept
+        {
+            const auto it = std::ranges::lower_bound(lines, first);
+            return it != lines.end() && *it <= last;
+        }
+    };
+
+    std::unordered_map<utils::resource::resource_location, file_breakpoints> breakpoints_;
 
     std::unordered_set<std::string, utils::hashers::string_hasher, std::equal_to<>> function_breakpoints_;
+    // function breakpoints translated to the identifiers of the running analysis
+    std::unordered_set<context::id_index> function_breakpoint_ids_;
+    bool function_breakpoint_ids_valid_ = false;
+
+    // file of the last checked statement
+    utils::resource::resource_location last_breakpoint_loc_;
+    file_breakpoints* last_breakpoint_file_ = nullptr;
 
     size_t add_variable(std::vector<variable> vars)
     {
@@ -181,6 +293,10 @@ public:
         workspace_manager_response<bool> resp)
     {
         opencode_source_uri_ = source;
+        for (auto& [_, file] : breakpoints_)
+            reset_breakpoint_states(file);
+        function_breakpoint_ids_valid_ = false;
+        invalidate_breakpoint_lookup();
         continue_ = true;
         stop_on_next_stmt_ = stop_on_entry;
         stop_on_stack_changes_ = false;
@@ -251,44 +367,26 @@ public:
 
         const bool actr_limit = ctx_->get_branch_counter() < 0;
 
-        const bool function_breakpoint_hit = function_breakpoints_.contains(op_code.to_string_view());
-
-        range stmt_range = resolved_stmt->stmt_range_ref();
-
-        bool breakpoint_hit = false;
-
-        auto stack_node = ctx_->processing_stack();
-        auto stack = ctx_->processing_stack_details();
-
-        for (const auto& bp : breakpoints(stack.back().resource_loc))
-        {
-            if (bp.line >= stmt_range.start.line && bp.line <= stmt_range.end.line)
-                breakpoint_hit = true;
-        }
+        const bool function_breakpoint_hit = check_function_breakpoints(op_code);
 
-        const auto stack_condition_violated = [&cond = stop_on_stack_condition_](context::processing_stack_t cur) {
-            auto last = cur;
-            for (cur = cur.parent(); !cur.empty(); last = cur, cur = cur.parent())
-                if (cur == cond.first)
-                    break;
-            return cond.first != cur || (cond.second && *cond.second != last.frame().resource_loc);
-        };
+        const bool breakpoint_hit =
+            check_breakpoints(ctx_->current_statement_source(), resolved_stmt->stmt_range_ref());
 
-        // breakpoint check
+        // the processing stack is only materialized when the execution stops
         if (stop_on_next_stmt_ || breakpoint_hit || function_breakpoint_hit || actr_limit
-            || (stop_on_stack_changes_ && stack_condition_violated(stack_node)))
+            || (stop_on_stack_changes_ && ctx_->processing_stack_depth() <= stop_on_stack_depth_))
         {
             variables_.clear();
             stack_frames_.clear();
             scopes_.clear();
-            proc_stack_ = std::move(stack);
+            proc_stack_ = ctx_->processing_stack_details();
             last_system_variables_.clear();
 
             if (disconnected_)
                 return false;
             stop_on_next_stmt_ = false;
             stop_on_stack_changes_ = false;
-            stop_on_stack_condition_ = std::make_pair(stack_node, std::nullopt);
+            stop_on_stack_depth_ = proc_stack_.size();
 
             continue_ = false;
 
@@ -313,6 +411,135 @@ public:
 
     void analyze_aread_line(const utils::resource::resource_location&, size_t, std::string_view) override {}
 
+    void analyze_skipped_statement(const utils::resource::resource_location&, size_t, size_t) override {}
+
+    static void reset_breakpoint_states(file_breakpoints& file)
+    {
+        file.states.clear();
+        file.states.reserve(file.bps.size());
+        for (const auto& bp : file.bps)
+            file.states.emplace_back().hit = hit_condition(bp.hit_condition);
+    }
+
+    void invalidate_breakpoint_lookup()
+    {
+        last_breakpoint_loc_ = utils::resource::resource_location();
+        last_breakpoint_file_ = nullptr;
+    }
+
+    bool check_function_breakpoints(context::id_index op_code)
+    {
+        if (function_breakpoints_.empty())
+            return false;
+
+        if (!function_breakpoint_ids_valid_)
+        {
+            function_breakpoint_ids_.clear();
+            for (const auto& name : function_breakpoints_)
+                function_breakpoint_ids_.emplace(ctx_->add_id(name));
+            function_breakpoint_ids_valid_ = true;
+        }
+
+        return function_breakpoint_ids_.contains(op_code);
+    }
+
+    bool check_breakpoints(const utils::resource::resource_location& loc, const range& stmt_range)
+    {
+        if (breakpoints_.empty())
+            return false;
+
+        // consecutive statements usually come from the same file
+        if (loc != last_breakpoint_loc_)
+        {
+            auto it = breakpoints_.find(loc);
+            last_breakpoint_loc_ = loc;
+            last_breakpoint_file_ = it == breakpoints_.end() ? nullptr : &it->second;
+        }
+        if (!last_breakpoint_file_)
+            return false;
+
+        auto& file = *last_breakpoint_file_;
+        if (!file.any_in(stmt_range.start.line, stmt_range.end.line))
+            return false;
+
+        bool hit = false;
+        for (size_t i = 0; i < file.bps.size(); ++i)
+        {
+            const auto& bp = file.bps[i];
+            if (bp.line < stmt_range.start.line || bp.line > stmt_range.end.line)
+                continue;
+            auto& state = file.states[i];
+            if (!condition_satisfied(bp, state))
+                continue;
+            if (state.hit.satisfied(++state.hits))
+                hit = true;
+        }
+        return hit;
+    }
+
+    // unparsable conditions and evaluation errors stop the execution, so the user can notice them
+    bool condition_satisfied(const breakpoint& bp, breakpoint_state& state)
+    {
+        if (bp.condition.empty())
+            return true;
+
+        if (!state.condition_parsed)
+        {
+            state.condition_parsed = true;
+            state.condition = parse_condition(bp.condition);
+        }
+
+        const auto* ca_op = state.condition ? state.condition->access_ca() : nullptr;
+        const auto* expr_op = ca_op ? ca_op->access_expr() : nullptr;
+        if (!expr_op || !expr_op->expression)
+            return true;
+
+        std::string error_msg;
+        error_collector diags(error_msg);
+        library_info_transitional lib_info(*lib_provider_);
+        const auto& scope = ctx_->current_scope();
+        const auto sysvars = ctx_->get_system_variables(scope);
+
+        const auto eval = expr_op->expression->evaluate({ *ctx_, lib_info, diags, scope, sysvars });
+
+        if (!error_msg.empty())
+            return true;
+
+        switch (eval.type())
+        {
+            case context::SET_t_enum::A_TYPE:
+                return eval.access_a() != 0;
+            case context::SET_t_enum::B_TYPE:
+                return eval.access_b();
+            default:
+                return true;
+        }
+    }
+
+    semantics::operand_ptr parse_condition(std::string_view condition) const
+    {
+        std::string text;
+        text.reserve(condition.size() + 2);
+        text.append("(").append(condition).append(")");
+
+        std::string error_msg;
+        error_collector diags(error_msg);
+
+        auto p = parsing::parser_holder(*ctx_, nullptr);
+        p.prepare_parser(lexing::u8string_view_with_newlines(text),
+            *ctx_,
+            &diags,
+            semantics::range_provider(),
+            range(),
+            1,
+            setb_status);
+
+        auto op = p.ca_op_expr();
+        if (!error_msg.empty())
+            return nullptr;
+        return op;
+    }
+
     // User controls of debugging.
     void next()
     {
@@ -328,11 +555,10 @@ public:
 
     void step_out()
     {
-        if (!stop_on_stack_condition_.first.empty())
+        if (stop_on_stack_depth_ > 1)
         {
             stop_on_stack_changes_ = true;
-            stop_on_stack_condition_ = std::make_pair(
-                stop_on_stack_condition_.first.parent(), stop_on_stack_condition_.first.frame().resource_loc);
+            --stop_on_stack_depth_;
         }
         else
             stop_on_next_stmt_ = false; // step out in the opencode is equivalent to continue
@@ -730,19 +956,34 @@ public:
 
     void breakpoints(const utils::resource::resource_location& source, std::span<const breakpoint> bps)
     {
-        breakpoints_[source].assign(bps.begin(), bps.end());
+        invalidate_breakpoint_lookup();
+        if (bps.empty())
+        {
+            breakpoints_.erase(source);
+            return;
+        }
+
+        auto& file = breakpoints_[source];
+        file.bps.assign(bps.begin(), bps.end());
+        reset_breakpoint_states(file);
+
+        file.lines.clear();
+        std::ranges::transform(bps, std::back_inserter(file.lines), &breakpoint::line);
+        std::ranges::sort(file.lines);
+        file.lines.erase(std::ranges::unique(file.lines).begin(), file.lines.end());
     }
 
     [[nodiscard]] std::span<const breakpoint> breakpoints(const utils::resource::resource_location& source) const
     {
         if (auto it = breakpoints_.find(source); it != breakpoints_.end())
-            return it->second;
+            return it->second.bps;
         return {};
     }
 
     void function_breakpoints(std::span<const function_breakpoint> bps)
     {
         function_breakpoints_.clear();
+        function_breakpoint_ids_valid_ = false;
         for (const auto& bp : bps)
             function_breakpoints_.emplace(utils::to_upper_copy(bp.name));
     }
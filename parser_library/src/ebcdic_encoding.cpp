@@ -63,12 +63,39 @@ std::pair<unsigned char, const char*> ebcdic_encoding::to_ebcdic_multibyte(const
     return { EBCDIC_SUB, c + 1 };
 }
 
+constinit const std::array<ebcdic_encoding::utf8_char, 256> ebcdic_encoding::e2u = []() {
+    std::array<utf8_char, 256> result {};
+    for (size_t c = 0; c < result.size(); ++c)
+    {
+        auto& u = result[c];
+        if (c == 0x0D || c == 0x25) // CR LF
+        {
+            u = {
+                3,
+                {
+                    static_cast<char>(0b11100000 | unicode_private >> 4),
+                    static_cast<char>(0x80 | (unicode_private & 0xf) << 2 | c >> 6),
+                    static_cast<char>(0x80 | c & 0x3f),
+                },
+            };
+        }
+        else if (const auto val = e2a[c]; val < 0x80)
+            u = { 1, { static_cast<char>(val) } };
+        else
+            u = { 2, { static_cast<char>(0xC0 | (val >> 6)), static_cast<char>(0x80 | (val & 63)) } };
+    }
+    return result;
+}();
+
 std::string ebcdic_encoding::to_ascii(const std::string& s)
 {
     std::string a;
     a.reserve(s.length());
     for (unsigned char c : s)
-        a.append(to_ascii(c));
+    {
+        const auto& u = e2u[c];
+        a.append(u.bytes, u.size);
+    }
     return a;
 }
 
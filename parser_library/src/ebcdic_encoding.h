@@ -15,6 +15,7 @@
 #ifndef HLASMPLUGIN_PARSER_HLASMEBCDIC_H
 #define HLASMPLUGIN_PARSER_HLASMEBCDIC_H
 
+#include <array>
 #include <string>
 #include <utility>
 
@@ -67,6 +68,14 @@ class ebcdic_encoding
     };
     // clang-format on
 
+    struct utf8_char
+    {
+        unsigned char size;
+        char bytes[3];
+    };
+    // UTF-8 representations of e2a, CR and LF are mapped to the private plane
+    static const std::array<utf8_char, 256> e2u;
+
 public:
     static constexpr unsigned char SUB = 26;
     static constexpr unsigned char EBCDIC_SUB = a2e[SUB];
@@ -89,17 +98,8 @@ public:
     // Converts EBCDIC character to UTF-8 string.
     static std::string to_ascii(unsigned char c)
     {
-        if (c == 0x0D || c == 0x25) // CR LF
-            return std::string {
-                static_cast<char>(0b11100000 | ebcdic_encoding::unicode_private >> 4),
-                static_cast<char>(0x80 | (ebcdic_encoding::unicode_private & 0xf) << 2 | c >> 6),
-                static_cast<char>(0x80 | c & 0x3f),
-            };
-        auto val = e2a[c];
-        if (val < 0x80)
-            return std::string({ static_cast<char>(val) });
-        else
-            return std::string({ static_cast<char>(0xC0 | (val >> 6)), static_cast<char>(0x80 | (val & 63)) });
+        const auto& u = e2u[c];
+        return std::string(u.bytes, u.size);
     }
     // Converts EBCDIC string to UTF-8 string.
     static std::string to_ascii(const std::string& s);
@@ -20,6 +20,7 @@
 
 #include "context/common_types.h"
 #include "context/ordinary_assembly/dependable.h"
+#include "context/statement_arena.h"
 #include "diagnostic_consumer.h"
 #include "range.h"
 
@@ -51,7 +52,7 @@ struct ca_expression_ctx
 };
 
 // base class for conditional assembly expressions
-class ca_expression
+class ca_expression : public context::arena_allocated
 {
 public:
     range expr_range;
@@ -14,9 +14,12 @@
 
 #include "ca_function.h"
 
-#include <bitset>
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <charconv>
+#include <span>
+#include <string_view>
 
 #include "ca_string.h"
 #include "context/hlasm_context.h"
@@ -34,6 +37,71 @@
 
 namespace hlasm_plugin::parser_library::expressions {
 
+namespace {
+constexpr std::string_view hex_digits = "0123456789ABCDEF";
+
+constexpr unsigned char invalid_digit = 0xff;
+constexpr auto hex_values = []() {
+    std::array<unsigned char, 256> result;
+    result.fill(invalid_digit);
+    for (unsigned char i = 0; i < 16; ++i)
+        result[static_cast<unsigned char>(hex_digits[i])] = i;
+    for (unsigned char i = 10; i < 16; ++i)
+        result['a' + i - 10] = i;
+    return result;
+}();
+
+// binary representation of every byte value
+constexpr auto byte_bits = []() {
+    std::array<std::array<char, 8>, 256> result {};
+    for (size_t v = 0; v < result.size(); ++v)
+        for (size_t b = 0; b < 8; ++b)
+            result[v][b] = v >> (7 - b) & 1 ? '1' : '0';
+    return result;
+}();
+
+// C locale case mapping
+constexpr auto upper_case = []() {
+    std::array<char, 256> result {};
+    for (size_t c = 0; c < result.size(); ++c)
+        result[c] = static_cast<char>(c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c);
+    return result;
+}();
+constexpr auto lower_case = []() {
+    std::array<char, 256> result {};
+    for (size_t c = 0; c < result.size(); ++c)
+        result[c] = static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+    return result;
+}();
+
+bool append_bits(unsigned char& value, std::string_view digits)
+{
+    for (unsigned char c : digits)
+    {
+        const unsigned char bit = c - '0';
+        if (bit > 1)
+            return false;
+        value = value << 1 | bit;
+    }
+    return true;
+}
+
+// calls f for every character of the string with the doubled apostrophes and ampersands collapsed
+template<typename F>
+void for_each_dc_chunk(std::string_view s, F f)
+{
+    constexpr auto special = [](char c) { return c == '\'' || c == '&'; };
+    for (auto it = std::ranges::find_if(s, special); it != s.end(); it = std::ranges::find_if(s, special))
+    {
+        const auto pos = static_cast<size_t>(it - s.begin());
+        f(s.substr(0, pos + 1));
+        const bool doubled = pos + 1 < s.size() && s[pos + 1] == s[pos];
+        s.remove_prefix(pos + 1 + doubled);
+    }
+    f(s);
+}
+} // namespace
+
 ca_function::ca_function(context::id_index function_name,
     ca_expr_funcs function,
     std::vector<ca_expr_ptr> parameters,
@@ -289,21 +357,18 @@ context::SET_t ca_function::D2A(std::string_view param, diagnostic_adder& add_di
 context::SET_t ca_function::DCLEN(const context::C_t& param)
 {
     context::A_t ret = 0;
-    const char* c = param.c_str();
-    while (c < param.c_str() + param.size())
-    {
-        if ((*c == '\'' && *(c + 1) == '\'') || (*c == '&' && *(c + 1) == '&'))
-            ++c;
-        ++ret;
-        ++c;
-    }
+    for_each_dc_chunk(param, [&ret](std::string_view chunk) { ret += (context::A_t)chunk.size(); });
     return ret;
 }
 
 context::SET_t ca_function::FIND(const context::C_t& lhs, const context::C_t& rhs)
 {
-    auto idx = lhs.find_first_of(rhs);
-    return idx == std::string::npos ? 0 : (context::A_t)idx + 1;
+    std::array<bool, 256> searched {};
+    for (unsigned char c : rhs)
+        searched[c] = true;
+
+    const auto it = std::ranges::find_if(lhs, [&searched](unsigned char c) { return searched[c]; });
+    return it == lhs.end() ? 0 : (context::A_t)(it - lhs.begin()) + 1;
 }
 
 context::SET_t ca_function::INDEX(const context::C_t& lhs, const context::C_t& rhs)
@@ -349,7 +414,8 @@ context::SET_t ca_function::ISHEX(const context::C_t& param, diagnostic_adder& a
     if (param.empty())
         RET_ERRPARM;
 
-    if (param.size() <= 8 && std::ranges::all_of(param, [](unsigned char c) { return std::isxdigit(c); }))
+    if (param.size() <= 8
+        && std::ranges::all_of(param, [](unsigned char c) { return hex_values[c] != invalid_digit; }))
         return true;
     return false;
 }
@@ -380,7 +446,16 @@ context::SET_t ca_function::X2A(std::string_view param, diagnostic_adder& add_di
     return *reinterpret_cast<int*>(&res);
 }
 
-context::SET_t ca_function::A2B(context::A_t param) { return std::bitset<32>(param).to_string(); }
+context::SET_t ca_function::A2B(context::A_t param)
+{
+    const std::uint32_t uparam = param;
+    std::string result(32, '0');
+
+    for (int i = 0; i < 4; ++i)
+        std::ranges::copy(byte_bits[uparam >> (24 - 8 * i) & 0xff], result.begin() + 8 * i);
+
+    return result;
+}
 
 context::SET_t ca_function::A2C(context::A_t param)
 {
@@ -405,11 +480,11 @@ context::SET_t ca_function::A2D(context::A_t param)
 
 context::SET_t ca_function::A2X(context::A_t param)
 {
-    unsigned long uparam = param;
-    std::string result;
+    const std::uint32_t uparam = param;
+    std::string result(8, '0');
 
-    for (int shift = 28; shift >= 0; shift -= 4)
-        result.push_back("0123456789ABCDEF"[(uparam >> shift) & 0xf]);
+    for (int i = 0; i < 8; ++i)
+        result[i] = hex_digits[uparam >> (28 - 4 * i) & 0xf];
 
     return result;
 }
@@ -419,34 +494,21 @@ context::SET_t ca_function::B2C(const context::C_t& param, diagnostic_adder& add
     if (param.empty())
         return "";
 
-    size_t algn = 0;
-    if (param.size() % 8 != 0)
-        algn = 8 - param.size() % 8;
-
-    std::string new_str;
-
-    for (size_t i = 0; i < algn; ++i)
-        new_str.push_back('0');
+    std::string ebcdic;
+    ebcdic.reserve((param.size() + 7) / 8);
 
-    new_str += param;
-
-    std::string ret;
-    ret.reserve(new_str.size() / 8);
-
-    for (size_t i = 0; i < new_str.size() / 8; ++i)
+    // the first group is padded with zeros
+    std::string_view digits = param;
+    for (size_t group = (digits.size() - 1) % 8 + 1; !digits.empty(); group = 8)
     {
         unsigned char c = 0;
-        for (size_t j = 0; j < 8; ++j)
-        {
-            unsigned char bit = new_str[i * 8 + j] - '0';
-            if (bit != 0 && bit != 1)
-                RET_ERRPARM;
-            c = (c << 1) + bit;
-        }
-        ret.append(ebcdic_encoding::to_ascii(c));
+        if (!append_bits(c, digits.substr(0, group)))
+            RET_ERRPARM;
+        ebcdic.push_back(c);
+        digits.remove_prefix(group);
     }
 
-    return ret;
+    return ebcdic_encoding::to_ascii(ebcdic);
 }
 
 context::SET_t ca_function::B2D(const context::C_t& param, diagnostic_adder& add_diagnostic)
@@ -462,31 +524,18 @@ context::SET_t ca_function::B2X(const context::C_t& param, diagnostic_adder& add
     if (param.empty())
         return "";
 
-    size_t algn = 0;
-    if (param.size() % 4 != 0)
-        algn = 4 - param.size() % 4;
-
-    std::string new_str;
+    std::string ret((param.size() + 3) / 4, '0');
+    auto out = ret.begin();
 
-    for (size_t i = 0; i < algn; ++i)
-        new_str.push_back('0');
-
-    new_str += param;
-
-    std::string ret;
-    ret.resize(new_str.size() / 4);
-
-    for (size_t i = 0; i < new_str.size() / 4; ++i)
+    // the first group is padded with zeros
+    std::string_view digits = param;
+    for (size_t group = (digits.size() - 1) % 4 + 1; !digits.empty(); group = 4)
     {
         unsigned char c = 0;
-        for (size_t j = 0; j < 4; ++j)
-        {
-            unsigned char bit = new_str[i * 4 + j] - '0';
-            if (bit != 0 && bit != 1)
-                RET_ERRPARM;
-            c = (c << 1) + bit;
-        }
-        ret[i] = "0123456789ABCDEF"[c];
+        if (!append_bits(c, digits.substr(0, group)))
+            RET_ERRPARM;
+        *out++ = hex_digits[c];
+        digits.remove_prefix(group);
     }
 
     return ret;
@@ -508,18 +557,21 @@ context::SET_t ca_function::C2B(const context::C_t& param, diagnostic_adder& add
     const char* c = std::to_address(param.cbegin());
     const auto ce = std::to_address(param.cend());
 
-    std::string ret;
-    ret.reserve(std::min(param.size() * 8, ca_string::MAX_STR_SIZE));
-    while (c != ce && ret.size() + 8 <= ca_string::MAX_STR_SIZE)
+    // the output is sized for single-byte characters and trimmed afterwards
+    std::string ret(std::min(param.size(), ca_string::MAX_STR_SIZE / 8) * 8, '0');
+    auto out = ret.begin();
+    while (c != ce && out != ret.end())
     {
         const auto [value, newc] = ebcdic_encoding::to_ebcdic(c, ce);
-        ret.append(std::bitset<8>(value).to_string());
+        out = std::ranges::copy(byte_bits[value], out).out;
         c = newc;
     }
 
     if (c != ce)
         RET_ERRPARM;
 
+    ret.erase(out, ret.end());
+
     return ret;
 }
 
@@ -539,14 +591,15 @@ context::SET_t ca_function::C2X(const context::C_t& param, diagnostic_adder& add
     const char* c = std::to_address(param.cbegin());
     const auto ce = std::to_address(param.cend());
 
-    std::string ret;
-    ret.reserve(std::min(param.size() * 2, ca_string::MAX_STR_SIZE));
-    while (c != ce && ret.size() + 2 <= ca_string::MAX_STR_SIZE)
+    // the output is sized for single-byte characters and trimmed afterwards
+    std::string ret(std::min(param.size(), ca_string::MAX_STR_SIZE / 2) * 2, '0');
+    auto out = ret.begin();
+    while (c != ce && out != ret.end())
     {
         const auto [value, newc] = ebcdic_encoding::to_ebcdic(c, ce);
 
-        ret.push_back("0123456789ABCDEF"[value >> 4]);
-        ret.push_back("0123456789ABCDEF"[value & 0xf]);
+        *out++ = hex_digits[value >> 4];
+        *out++ = hex_digits[value & 0xf];
 
         c = newc;
     }
@@ -554,6 +607,8 @@ context::SET_t ca_function::C2X(const context::C_t& param, diagnostic_adder& add
     if (c != ce)
         RET_ERRPARM;
 
+    ret.erase(out, ret.end());
+
     return ret;
 }
 
@@ -593,14 +648,8 @@ context::SET_t ca_function::D2X(const context::C_t& param, diagnostic_adder& add
 context::SET_t ca_function::DCVAL(const context::C_t& param)
 {
     std::string ret;
-    const char* c = param.c_str();
-    while (c < param.c_str() + param.size())
-    {
-        if ((*c == '\'' && *(c + 1) == '\'') || (*c == '&' && *(c + 1) == '&'))
-            ++c;
-        ret.push_back(*c);
-        ++c;
-    }
+    ret.reserve(param.size());
+    for_each_dc_chunk(param, [&ret](std::string_view chunk) { ret.append(chunk); });
     return ret;
 }
 
@@ -620,8 +669,17 @@ context::SET_t ca_function::DEQUOTE(context::C_t param)
 
 context::SET_t ca_function::DOUBLE(const context::C_t& param, diagnostic_adder& add_diagnostic)
 {
+    const auto doubled =
+        static_cast<size_t>(std::ranges::count_if(param, [](char c) { return c == '\'' || c == '&'; }));
+
+    if (param.size() + doubled > ca_string::MAX_STR_SIZE)
+        RET_ERRPARM;
+
+    if (doubled == 0)
+        return param;
+
     std::string ret;
-    ret.reserve(param.size());
+    ret.reserve(param.size() + doubled);
     for (char c : param)
     {
         ret.push_back(c);
@@ -629,9 +687,6 @@ context::SET_t ca_function::DOUBLE(const context::C_t& param, diagnostic_adder&
             ret.push_back(c);
     }
 
-    if (ret.size() > ca_string::MAX_STR_SIZE)
-        RET_ERRPARM;
-
     return ret;
 }
 
@@ -639,7 +694,7 @@ context::SET_t ca_function::ESYM(const context::C_t&) { return context::SET_t();
 
 context::SET_t ca_function::LOWER(context::C_t param)
 {
-    std::ranges::transform(param, param.begin(), [](unsigned char c) { return (char)tolower(c); });
+    std::ranges::transform(param, param.begin(), [](unsigned char c) { return lower_case[c]; });
     return param;
 }
 
@@ -684,7 +739,7 @@ context::SET_t ca_function::SYSATTRP(const context::C_t& name, const evaluation_
 
 context::SET_t ca_function::UPPER(context::C_t param)
 {
-    std::ranges::transform(param, param.begin(), [](unsigned char c) { return (char)toupper(c); });
+    std::ranges::transform(param, param.begin(), [](unsigned char c) { return upper_case[c]; });
     return param;
 }
 
@@ -696,17 +751,15 @@ context::SET_t ca_function::X2B(const context::C_t& param, diagnostic_adder& add
     if (param.size() * 4 > ca_string::MAX_STR_SIZE)
         RET_ERRPARM;
 
-    std::string ret;
-    ret.reserve(param.size() * 4);
-    for (auto c = param.c_str(); c != param.c_str() + param.size(); ++c)
+    std::string ret(param.size() * 4, '0');
+    auto out = ret.begin();
+    for (unsigned char c : param)
     {
-        unsigned char value = 0;
-        if (std::isxdigit((unsigned char)*c))
-            std::from_chars(c, c + 1, value, 16);
-        else
+        const auto value = hex_values[c];
+        if (value == invalid_digit)
             RET_ERRPARM;
 
-        ret.append(std::bitset<4>(value).to_string());
+        out = std::ranges::copy(std::span(byte_bits[value]).subspan<4>(), out).out;
     }
     return ret;
 }
@@ -716,25 +769,26 @@ context::SET_t ca_function::X2C(const context::C_t& param, diagnostic_adder& add
     if (param.empty())
         return "";
 
-    std::string new_string;
-    new_string.reserve(param.size());
+    std::string ebcdic;
+    ebcdic.reserve((param.size() + 1) / 2);
 
-    if (param.size() % 2 == 1)
-        new_string.push_back('0');
-    new_string += param;
-
-    std::string ret;
-    for (auto c = new_string.c_str(); c != new_string.c_str() + new_string.size(); c += 2)
+    // the first byte is padded with zero
+    std::string_view digits = param;
+    for (size_t group = 2 - digits.size() % 2; !digits.empty(); group = 2)
     {
         unsigned char value = 0;
-        if (std::isxdigit((unsigned char)*c))
-            std::from_chars(c, c + 2, value, 16);
-        else
-            RET_ERRPARM;
-
-        ret.append(ebcdic_encoding::to_ascii(value));
+        for (unsigned char c : digits.substr(0, group))
+        {
+            const auto v = hex_values[c];
+            if (v == invalid_digit)
+                RET_ERRPARM;
+            value = value << 4 | v;
+        }
+        ebcdic.push_back(value);
+        digits.remove_prefix(group);
     }
-    return ret;
+
+    return ebcdic_encoding::to_ascii(ebcdic);
 }
 
 context::SET_t ca_function::X2D(const context::C_t& param, diagnostic_adder& add_diagnostic)
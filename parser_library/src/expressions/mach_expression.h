@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "context/ordinary_assembly/dependable.h"
+#include "context/statement_arena.h"
 #include "diagnostic_consumer.h"
 
 
@@ -34,7 +35,7 @@ using mach_expr_list = std::vector<mach_expr_ptr>;
 // whole machine expression.
 // It can be evaluated using context::dependency_solver& that provides
 // information about values of ordinary symbols.
-class mach_expression : public context::resolvable
+class mach_expression : public context::resolvable, public context::arena_allocated
 {
     virtual bool do_is_similar(const mach_expression& expr) const = 0;
 
@@ -18,6 +18,7 @@ namespace hlasm_plugin::parser_library {
 
 const lib_config default_config {
     .diag_supress_limit = 10,
+    .minimal_lsp_index = true,
 };
 
 namespace {
@@ -25,6 +26,8 @@ lib_config combine_two_configs(lib_config combined, const lib_config& second)
 {
     if (!combined.diag_supress_limit.has_value())
         combined.diag_supress_limit = second.diag_supress_limit;
+    if (!combined.minimal_lsp_index.has_value())
+        combined.minimal_lsp_index = second.minimal_lsp_index;
     return combined;
 }
 } // namespace
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "completion_filter.h"
+
+#include "utils/string_operations.h"
+
+namespace hlasm_plugin::parser_library::lsp {
+
+bool matches_completion_prefix(std::string_view prefix, std::string_view name)
+{
+    if (prefix.empty())
+        return true;
+    if (name.empty() || utils::upper_cased[(unsigned char)prefix.front()] != name.front())
+        return false;
+
+    for (auto c : prefix.substr(1))
+    {
+        const auto p = name.find(utils::upper_cased[(unsigned char)c], 1);
+        if (p == std::string_view::npos)
+            return false;
+        name.remove_prefix(p);
+    }
+    return true;
+}
+
+std::string upper_cased_prefix(std::string_view prefix)
+{
+    std::string result;
+    result.reserve(prefix.size());
+    for (auto c : prefix)
+        result.push_back(utils::upper_cased[(unsigned char)c]);
+    return result;
+}
+
+} // namespace hlasm_plugin::parser_library::lsp
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_LSP_COMPLETION_FILTER_H
+#define HLASMPLUGIN_PARSERLIBRARY_LSP_COMPLETION_FILTER_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hlasm_plugin::parser_library::lsp {
+
+// the client asks for a new list on every keystroke, so only the best candidates need to be sent
+inline constexpr std::size_t completion_list_limit = 100;
+
+// mirrors the client side filtering: the first character must match, the rest is a subsequence
+bool matches_completion_prefix(std::string_view prefix, std::string_view name);
+
+std::string upper_cased_prefix(std::string_view prefix);
+
+// selects at most limit candidates matching the prefix from a sequence sorted by the (upper-cased) name,
+// names starting with the prefix come first, the remaining fuzzy matches follow
+template<typename T, typename Proj>
+requires std::convertible_to<std::invoke_result_t<Proj&, const T&>, std::string_view>
+std::vector<T> select_completion_candidates(
+    std::span<const T> sorted, std::string_view prefix, Proj proj, std::size_t limit = completion_list_limit)
+{
+    const auto name = [&proj](const T& e) -> std::string_view { return std::invoke(proj, e); };
+
+    std::vector<T> result;
+    const auto take = [&result, limit, &name](auto first, auto last, std::string_view fuzzy) {
+        for (; first != last && result.size() < limit; ++first)
+        {
+            if (fuzzy.empty() || matches_completion_prefix(fuzzy, name(*first)))
+                result.push_back(*first);
+        }
+    };
+
+    const auto upper = upper_cased_prefix(prefix);
+    if (upper.empty())
+    {
+        take(sorted.begin(), sorted.end(), {});
+        return result;
+    }
+
+    const auto [first, last] = std::ranges::equal_range(sorted, upper.front(), {}, [&name](const T& e) {
+        const auto n = name(e);
+        return n.empty() ? '\0' : n.front();
+    });
+    const auto prefix_first = std::ranges::lower_bound(first, last, std::string_view(upper), {}, name);
+    const auto prefix_last = std::ranges::partition_point(
+        prefix_first, last, [&upper, &name](const T& e) { return name(e).starts_with(upper); });
+
+    take(prefix_first, prefix_last, {});
+    take(first, prefix_first, upper);
+    take(prefix_last, last, upper);
+
+    return result;
+}
+
+} // namespace hlasm_plugin::parser_library::lsp
+
+#endif
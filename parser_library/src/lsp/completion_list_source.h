@@ -15,7 +15,6 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_LSP_COMPLETION_LIST_SOURCE_H
 #define HLASMPLUGIN_PARSERLIBRARY_LSP_COMPLETION_LIST_SOURCE_H
 
-#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -43,7 +42,8 @@ struct completion_list_instructions
 {
     std::string_view completed_text;
     size_t completed_text_start_column;
-    const std::unordered_map<const context::macro_definition*, std::shared_ptr<macro_info>>* macros;
+    // sorted by name
+    const std::vector<const macro_info*>* macros;
     const lsp_context* lsp_ctx;
 
     std::vector<std::string> additional_instructions;
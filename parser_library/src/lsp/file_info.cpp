@@ -15,15 +15,9 @@
 #include "file_info.h"
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
 
-namespace {
-constexpr auto occurrence_end_line(const hlasm_plugin::parser_library::lsp::symbol_occurrence& o)
-{
-    return o.occurrence_range.end.line;
-}
-} // namespace
-
 namespace hlasm_plugin::parser_library::lsp {
 
 file_info::file_info(text_data_view text_data)
@@ -51,71 +45,87 @@ bool file_info::is_in_range(const position& pos, const range& r)
 
 occurrence_scope_t file_info::find_occurrence_with_scope(position pos) const
 {
-    std::pair<const symbol_occurrence*, size_t> found_pair(nullptr, (size_t)-1);
-    auto& [found, priority] = found_pair;
+    static constexpr auto npos = (size_t)-1;
+    size_t found = npos;
+    size_t found_line = 0;
+    size_t priority = npos;
 
-    auto l = std::ranges::lower_bound(occurrences, pos.line, {}, occurrence_end_line);
-    auto it_limit = occurrences_start_limit.begin() + std::ranges::distance(occurrences.begin(), l);
-    // find in occurrences
-    for (auto it = l; it != occurrences.end() && *it_limit <= pos.line; ++it, ++it_limit)
+    // occurrences ending before the position are skipped, the scan stops once no remaining one can start early enough
+    for (size_t l = pos.line; l < occurrences.lines() && occurrences.start_limit(l) <= pos.line && priority != 0; ++l)
     {
-        const auto& occ = *it;
-        if (is_in_range(pos, occ.occurrence_range))
+        for (auto i = occurrences.first_ending_at(l), e = occurrences.first_ending_at(l + 1); i < e; ++i)
         {
-            auto occ_priority = 1 * occ.evaluated_model + 2 * (occ.kind == occurrence_kind::INSTR_LIKE);
-            if (!found || occ_priority < priority)
-                found_pair = { &occ, occ_priority };
+            if (!is_in_range(pos, occurrences.occurrence_range(i, l)))
+                continue;
+
+            auto occ_priority =
+                1 * occurrences.evaluated_model(i) + 2 * (occurrences.kind(i) == occurrence_kind::INSTR_LIKE);
+            if (found == npos || occ_priority < priority)
+            {
+                found = i;
+                found_line = l;
+                priority = occ_priority;
+            }
             if (priority == 0)
                 break;
         }
     }
 
     // if not found, return
-    if (!found)
-        return std::make_pair(nullptr, nullptr);
+    if (found == npos)
+        return {};
 
     // else, find scope
-    const auto* macro_i = find_scope(pos);
-    return std::make_pair(found, macro_i);
+    return { occurrences.get(found, found_line), find_scope(pos) };
 }
 
-const symbol_occurrence* file_info::find_closest_instruction(position pos) const noexcept
+size_t file_info::find_closest_instruction_index(position pos) const noexcept
 {
-    auto l = std::ranges::upper_bound(occurrences, pos.line, {}, occurrence_end_line);
-    auto instr = std::find_if(std::make_reverse_iterator(l), occurrences.rend(), [](const auto& occ) {
-        return occ.kind == occurrence_kind::INSTR || occ.kind == occurrence_kind::INSTR_LIKE;
-    });
-    if (instr == occurrences.rend() || instr->kind != occurrence_kind::INSTR)
-        return nullptr;
+    for (auto i = occurrences.first_ending_at(pos.line + 1); i-- > 0;)
+    {
+        const auto kind = occurrences.kind(i);
+        if (kind == occurrence_kind::INSTR)
+            return i;
+        if (kind == occurrence_kind::INSTR_LIKE)
+            break;
+    }
+    return (size_t)-1;
+}
 
-    if (instr->occurrence_range.start.line >= line_details.size())
-        return nullptr;
+std::optional<symbol_occurrence> file_info::find_closest_instruction(position pos) const noexcept
+{
+    const auto instr = find_closest_instruction_index(pos);
+    if (instr == (size_t)-1)
+        return std::nullopt;
+
+    const auto end_line = occurrences.end_line(instr);
+    const auto start_line = occurrences.occurrence_range(instr, end_line).start.line;
+    if (start_line >= line_details.size())
+        return std::nullopt;
 
-    const auto& ld = line_details[instr->occurrence_range.start.line];
+    const auto& ld = line_details[start_line];
     if (ld.max_endline == 0)
-        return nullptr;
+        return std::nullopt;
 
     // pos.column == 15 is a workaround around incorrect range assignment for statements that were freshly continued
     if (pos.line >= ld.max_endline + (pos.column == 15))
-        return nullptr;
+        return std::nullopt;
 
-    return std::to_address(instr);
+    return occurrences.get(instr, end_line);
 }
 
 std::pair<const context::section*, index_t<context::using_collection>> file_info::find_reachable_sections(
     position pos) const
 {
-    auto l = std::ranges::upper_bound(occurrences, pos.line, {}, occurrence_end_line);
-    auto instr = std::find_if(std::make_reverse_iterator(l), occurrences.rend(), [](const auto& occ) {
-        return occ.kind == occurrence_kind::INSTR || occ.kind == occurrence_kind::INSTR_LIKE;
-    });
-    if (instr == occurrences.rend() || instr->kind != occurrence_kind::INSTR)
+    const auto instr = find_closest_instruction_index(pos);
+    if (instr == (size_t)-1)
         return {};
 
-    if (instr->occurrence_range.start.line >= line_details.size())
+    const auto start_line = occurrences.occurrence_range(instr, occurrences.end_line(instr)).start.line;
+    if (start_line >= line_details.size())
         return {};
 
-    const auto& ld = line_details[instr->occurrence_range.start.line];
+    const auto& ld = line_details[start_line];
 
     return { ld.active_section, ld.active_using };
 }
@@ -148,13 +158,10 @@ std::vector<bool> file_info::macro_map() const
     return result;
 }
 
-std::vector<position> file_info::find_references(
-    const symbol_occurrence& occurrence, const std::vector<symbol_occurrence>& occurrences)
+std::vector<position> file_info::find_references(const symbol_occurrence& occurrence, const macro_info* scope) const
 {
     std::vector<position> result;
-    for (const auto& occ : occurrences)
-        if (occurrence.is_similar(occ))
-            result.emplace_back(occ.occurrence_range.start);
+    occurrences.find_similar(occurrence, scope, result);
     std::ranges::sort(result);
     result.erase(std::ranges::unique(result).begin(), result.end());
     return result;
@@ -163,8 +170,23 @@ std::vector<position> file_info::find_references(
 void file_info::update_occurrences(const std::vector<symbol_occurrence>& occurrences_upd,
     const std::vector<lsp::line_occurence_details>& line_details_upd)
 {
-    occurrences.insert(occurrences.end(), occurrences_upd.begin(), occurrences_upd.end());
+    std::ranges::transform(occurrences_upd, std::back_inserter(pending_occurrences), [](const auto& occ) {
+        return scoped_occurrence { occ };
+    });
+    merge_line_details(line_details_upd);
+}
+
+void file_info::update_occurrences(const occurrence_index& occurrences_upd,
+    const std::vector<lsp::line_occurence_details>& line_details_upd,
+    const macro_info* scope)
+{
+    pending_occurrences.reserve(pending_occurrences.size() + occurrences_upd.size());
+    occurrences_upd.for_each([this, scope](symbol_occurrence occ) { pending_occurrences.emplace_back(occ, scope); });
+    merge_line_details(line_details_upd);
+}
 
+void file_info::merge_line_details(const std::vector<lsp::line_occurence_details>& line_details_upd)
+{
     static constexpr auto merge_lines = [](const auto& o, const auto& n) {
         return lsp::line_occurence_details {
             std::max(o.max_endline, n.max_endline),
@@ -254,30 +276,16 @@ file_slice_t file_slice_t::transform_slice(
     return fslice;
 }
 
-const std::vector<symbol_occurrence>& file_info::get_occurrences() const { return occurrences; }
-
-void file_info::process_occurrences()
-{
-    std::ranges::sort(occurrences, {}, [](const auto& e) {
-        return std::tie(e.occurrence_range.end.line, e.occurrence_range.start.line, e.evaluated_model);
-    });
-
-    occurrences_start_limit.resize(occurrences.size());
-
-    auto m = (size_t)-1;
-    std::transform(occurrences.rbegin(), occurrences.rend(), occurrences_start_limit.rbegin(), [&m](const auto& occ) {
-        return m = std::min(m, occ.occurrence_range.start.line);
-    });
-}
+void file_info::process_occurrences() { occurrences.assign(std::exchange(pending_occurrences, {})); }
 
 void file_info::collect_instruction_like_references(
     std::unordered_map<context::id_index, utils::resource::resource_location>& m) const
 {
-    for (const auto& occ : occurrences)
+    for (size_t i = 0; i < occurrences.size(); ++i)
     {
-        if (occ.kind != occurrence_kind::INSTR_LIKE)
+        if (occurrences.kind(i) != occurrence_kind::INSTR_LIKE)
             continue;
-        m.try_emplace(occ.name);
+        m.try_emplace(occurrences.name(i));
     }
 }
 
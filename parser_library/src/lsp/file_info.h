@@ -16,6 +16,8 @@
 #define LSP_FILE_INFO_H
 
 #include <compare>
+#include <cstdint>
+#include <optional>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -23,6 +25,7 @@
 #include "context/copy_member.h"
 #include "context/statement_id.h"
 #include "macro_info.h"
+#include "occurrence_index.h"
 #include "symbol_occurrence.h"
 #include "text_data_view.h"
 #include "utils/resource_location.h"
@@ -74,7 +77,7 @@ enum class file_type
 
 class file_info;
 
-using occurrence_scope_t = std::pair<const symbol_occurrence*, const macro_info*>;
+using occurrence_scope_t = std::pair<std::optional<symbol_occurrence>, const macro_info*>;
 
 class file_info
 {
@@ -95,17 +98,20 @@ public:
 
     occurrence_scope_t find_occurrence_with_scope(position pos) const;
     const macro_info* find_scope(position pos) const;
-    static std::vector<position> find_references(
-        const symbol_occurrence& occurrence, const std::vector<symbol_occurrence>& occurrences);
+    // scope is only relevant for scoped occurrences (nullptr for the open code)
+    std::vector<position> find_references(const symbol_occurrence& occurrence, const macro_info* scope) const;
 
     void update_occurrences(const std::vector<symbol_occurrence>& occurrences_upd,
         const std::vector<line_occurence_details>& line_details_upd);
-    const std::vector<symbol_occurrence>& get_occurrences() const;
+    void update_occurrences(const occurrence_index& occurrences_upd,
+        const std::vector<line_occurence_details>& line_details_upd,
+        const macro_info* scope);
     void process_occurrences();
+    const occurrence_index& get_occurrences() const noexcept { return occurrences; }
     void collect_instruction_like_references(
         std::unordered_map<context::id_index, utils::resource::resource_location>& m) const;
 
-    const symbol_occurrence* find_closest_instruction(position pos) const noexcept;
+    std::optional<symbol_occurrence> find_closest_instruction(position pos) const noexcept;
     std::pair<const context::section*, index_t<context::using_collection>> find_reachable_sections(position pos) const;
 
     const line_occurence_details* get_line_details(size_t l) const noexcept;
@@ -119,9 +125,14 @@ public:
 
 private:
     std::vector<file_slice_t> slices;
-    std::vector<symbol_occurrence> occurrences;
+    // occurrences are collected first and then compacted by process_occurrences
+    std::vector<scoped_occurrence> pending_occurrences;
+    occurrence_index occurrences;
     std::vector<line_occurence_details> line_details;
-    std::vector<size_t> occurrences_start_limit;
+
+    void merge_line_details(const std::vector<line_occurence_details>& line_details_upd);
+
+    size_t find_closest_instruction_index(position pos) const noexcept;
 };
 
 } // namespace hlasm_plugin::parser_library::lsp
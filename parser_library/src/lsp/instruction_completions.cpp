@@ -15,6 +15,7 @@
 #include "instruction_completions.h"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cassert>
 #include <numeric>
@@ -494,4 +495,22 @@ const instruction_completion_items_t instruction_completion_items = []() {
     return result;
 }();
 
+std::span<const completion_item* const> instruction_completion_index(instruction_set_version version)
+{
+    static const auto index = []() {
+        std::array<std::vector<const completion_item*>, (size_t)instruction_set_version::UNI + 1> result;
+        for (size_t v = (size_t)instruction_set_version::ZOP; v < result.size(); ++v)
+        {
+            for (const auto& [item, aff] : instruction_completion_items)
+            {
+                if (instructions::instruction_available(aff, (instruction_set_version)v))
+                    result[v].emplace_back(&item);
+            }
+        }
+        return result;
+    }();
+
+    return index[(size_t)version];
+}
+
 } // namespace hlasm_plugin::parser_library::lsp
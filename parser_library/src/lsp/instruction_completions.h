@@ -15,10 +15,12 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_INSTRUCTION_COMPLETIONS_H
 #define HLASMPLUGIN_PARSERLIBRARY_INSTRUCTION_COMPLETIONS_H
 
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "completion_item.h"
+#include "instruction_set_version.h"
 #include "instructions/instruction.h"
 
 namespace hlasm_plugin::parser_library::lsp {
@@ -26,6 +28,9 @@ namespace hlasm_plugin::parser_library::lsp {
 extern const std::vector<std::pair<completion_item, instructions::instruction_set_affiliation>>
     instruction_completion_items;
 
+// items available in the instruction set, sorted by label
+std::span<const completion_item* const> instruction_completion_index(instruction_set_version version);
+
 } // namespace hlasm_plugin::parser_library::lsp
 
 #endif
@@ -19,6 +19,7 @@
 #include <limits>
 
 #include "completion_item.h"
+#include "completion_filter.h"
 #include "context/hlasm_context.h"
 #include "context/ordinary_assembly/section.h"
 #include "context/ordinary_assembly/symbol.h"
@@ -458,42 +459,59 @@ std::vector<completion_item> generate_completion(
     std::vector<completion_item> result;
     const auto completed_text = convertor.convert_to(cli.completed_text);
 
-    // Store only instructions from the currently active instruction set
-    for (const auto& [instr, aff] : instruction_completion_items)
-    {
-        if (!instructions::instruction_available(aff, instruction_set))
-            continue;
-        // Coversion should not be needed
-        auto& i = result.emplace_back(instr);
-        if (auto space = i.insert_text.find(' '); space != std::string::npos)
-        {
-            if (auto col_pos = cli.completed_text_start_column + space; col_pos < 15)
-                i.insert_text.insert(i.insert_text.begin() + space, 15 - col_pos, ' ');
-        }
+    const auto mark_suggestion = [&](completion_item& i) {
         if (auto* suggestion = locate_suggestion(i.label);
             suggestion && !suggestion->first.starts_with(cli.completed_text))
         {
             i.suggestion_for = completed_text;
             suggestion->second = true;
         }
-    }
+    };
 
-    for (const auto& [_, macro_i] : *cli.macros)
-    {
-        auto& i = result.emplace_back(generate_completion_item(
-            *macro_i, cli.lsp_ctx->get_file_info(macro_i->definition_location.resource_loc), tc));
-        if (auto* suggestion = locate_suggestion(i.label);
-            suggestion && !suggestion->first.starts_with(cli.completed_text))
+    const auto add_instruction = [&](const completion_item& instr) {
+        // Coversion should not be needed
+        auto& i = result.emplace_back(instr);
+        if (auto space = i.insert_text.find(' '); space != std::string::npos)
         {
-            i.suggestion_for = completed_text;
-            suggestion->second = true;
+            if (auto col_pos = cli.completed_text_start_column + space; col_pos < 15)
+                i.insert_text.insert(i.insert_text.begin() + space, 15 - col_pos, ' ');
         }
-    }
+        mark_suggestion(i);
+    };
+    const auto add_macro = [&](const macro_info& macro_i) {
+        mark_suggestion(result.emplace_back(generate_completion_item(
+            macro_i, cli.lsp_ctx->get_file_info(macro_i.definition_location.resource_loc), tc)));
+    };
+
+    static constexpr auto instruction_label = [](const completion_item* i) -> std::string_view { return i->label; };
+    static constexpr auto macro_name = [](const macro_info* m) { return m->macro_definition->id.to_string_view(); };
+
+    // Store only instructions from the currently active instruction set
+    const auto instructions = instruction_completion_index(instruction_set);
+    for (const auto* instr : select_completion_candidates(instructions, cli.completed_text, instruction_label))
+        add_instruction(*instr);
+
+    const auto macros = std::span<const macro_info* const>(*cli.macros);
+    for (const auto* macro_i : select_completion_candidates(macros, cli.completed_text, macro_name))
+        add_macro(*macro_i);
 
     for (const auto& [suggestion, used] : suggestions)
     {
         if (used)
             continue;
+        // suggestions do not have to match the completed text
+        if (auto it = std::ranges::lower_bound(instructions, std::string_view(suggestion), {}, instruction_label);
+            it != instructions.end() && (*it)->label == suggestion)
+        {
+            add_instruction(**it);
+            continue;
+        }
+        if (auto it = std::ranges::lower_bound(macros, std::string_view(suggestion), {}, macro_name);
+            it != macros.end() && macro_name(*it) == suggestion)
+        {
+            add_macro(**it);
+            continue;
+        }
         const auto cs = convertor.convert_to(suggestion);
         result.emplace_back(cs, "", cs, "", completion_item_kind::macro, false, completed_text);
     }
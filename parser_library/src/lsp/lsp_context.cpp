@@ -19,6 +19,7 @@
 #include <string_view>
 #include <unordered_map>
 
+#include "completion_filter.h"
 #include "completion_trigger_kind.h"
 #include "context/hlasm_context.h"
 #include "context/macro.h"
@@ -129,41 +130,37 @@ std::vector<document_symbol_item> lsp_context::document_symbol(
 
     const auto macro_map = dl_it->second.macro_map();
 
-    if (auto it = m_opencode->file_occurrences.find(dl); it != m_opencode->file_occurrences.end())
-    {
-        for (const auto& o : it->second.symbols)
-        {
-            if (o.occurrence_range.start.column != 0)
-                continue;
-            if (o.name.empty())
-                continue;
+    dl_it->second.get_occurrences().for_each([&](const symbol_occurrence& o) {
+        if (o.occurrence_range.start.column != 0)
+            return;
+        if (o.name.empty())
+            return;
 
-            std::string prefix;
-            document_symbol_kind kind = UNKNOWN;
+        std::string prefix;
+        document_symbol_kind kind = UNKNOWN;
 
-            switch (o.kind)
-            {
-                case occurrence_kind::ORD:
-                    if (const auto* sym = m_hlasm_ctx->ord_ctx.get_symbol(o.name))
-                    {
-                        if (auto origin = sym->attributes().origin(); origin != context::symbol_origin::SECT)
-                            kind = document_symbol_item_kind_mapping_symbol.at(origin);
-                        else if (const auto* sect = m_hlasm_ctx->ord_ctx.get_section(o.name))
-                            kind = document_symbol_item_kind_mapping_section.at(sect->kind);
-                    }
-                    break;
-                case occurrence_kind::SEQ:
-                    prefix = ".";
-                    kind = SEQ;
-                    break;
-                default:
-                    continue;
-            }
-            auto l = o.occurrence_range.start.line;
-            if (l >= macro_map.size() || !macro_map[l])
-                result.emplace_back(prefix + o.name.to_string(), kind, one_line(o.occurrence_range.start.line));
+        switch (o.kind)
+        {
+            case occurrence_kind::ORD:
+                if (const auto* sym = m_hlasm_ctx->ord_ctx.get_symbol(o.name))
+                {
+                    if (auto origin = sym->attributes().origin(); origin != context::symbol_origin::SECT)
+                        kind = document_symbol_item_kind_mapping_symbol.at(origin);
+                    else if (const auto* sect = m_hlasm_ctx->ord_ctx.get_section(o.name))
+                        kind = document_symbol_item_kind_mapping_section.at(sect->kind);
+                }
+                break;
+            case occurrence_kind::SEQ:
+                prefix = ".";
+                kind = SEQ;
+                break;
+            default:
+                return;
         }
-    }
+        auto l = o.occurrence_range.start.line;
+        if (l >= macro_map.size() || !macro_map[l])
+            result.emplace_back(prefix + o.name.to_string(), kind, one_line(o.occurrence_range.start.line));
+    });
 
     std::ranges::stable_sort(result, [](const auto& l, const auto& r) {
         if (const auto c = l.symbol_range.start.line <=> r.symbol_range.start.line; c != 0)
@@ -270,7 +267,10 @@ void lsp_context::add_macro(macro_info_ptr macro_i, text_data_view text_data)
     assert(inserted);
 }
 
-void lsp_context::add_opencode(opencode_info_ptr opencode_i, text_data_view text_data, parse_lib_provider& libs)
+void lsp_context::add_opencode(opencode_info_ptr opencode_i,
+    const file_occurrences_t& occurrences,
+    text_data_view text_data,
+    parse_lib_provider& libs)
 {
     m_opencode = std::move(opencode_i);
     m_files.try_emplace(m_hlasm_ctx->opencode_location(), std::move(text_data));
@@ -278,8 +278,9 @@ void lsp_context::add_opencode(opencode_info_ptr opencode_i, text_data_view text
     file_info::distribute_macro_slices(m_macros, m_files);
 
     for (const auto& [_, m] : m_macros)
-        distribute_file_occurrences(m->file_occurrences);
-    distribute_file_occurrences(m_opencode->file_occurrences);
+        distribute_file_occurrences(*m);
+    for (const auto& [file, occs] : occurrences)
+        m_files.at(file).update_occurrences(occs.symbols, occs.line_details);
 
     for (auto& [_, file] : m_files)
         file.process_occurrences();
@@ -329,14 +330,13 @@ location lsp_context::definition(const utils::resource::resource_location& docum
     return { pos, document_loc };
 }
 
-void collect_references(std::vector<location>& refs, const symbol_occurrence& occ, const file_occurrences_t& file_occs)
+std::optional<context::id_index> lsp_context::ordinary_symbol(
+    const utils::resource::resource_location& document_loc, position pos) const
 {
-    for (const auto& [file, occs] : file_occs)
-    {
-        auto file_refs = file_info::find_references(occ, occs.symbols);
-        for (auto&& ref : file_refs)
-            refs.emplace_back(std::move(ref), file);
-    }
+    auto [occ, _] = find_occurrence_with_scope(document_loc, pos);
+    if (!occ || occ->kind != lsp::occurrence_kind::ORD)
+        return std::nullopt;
+    return occ->name;
 }
 
 std::vector<location> lsp_context::references(
@@ -349,18 +349,10 @@ std::vector<location> lsp_context::references(
     if (!occ)
         return {};
 
-    if (occ->is_scoped())
+    for (const auto& [file, info] : m_files)
     {
-        if (macro_scope)
-            collect_references(result, *occ, macro_scope->file_occurrences);
-        else
-            collect_references(result, *occ, m_opencode->file_occurrences);
-    }
-    else
-    {
-        for (const auto& [_, mac_i] : m_macros)
-            collect_references(result, *occ, mac_i->file_occurrences);
-        collect_references(result, *occ, m_opencode->file_occurrences);
+        for (auto&& ref : info.find_references(*occ, macro_scope))
+            result.emplace_back(std::move(ref), file);
     }
 
     return result;
@@ -426,14 +418,14 @@ std::vector<std::pair<const context::section*, context::id_index>> gather_reacha
     return reachable_sections;
 }
 
-std::vector<std::pair<const context::symbol*, context::id_index>> compute_reachable_symbol_set(
-    const std::vector<std::pair<const context::section*, context::id_index>>& reachable_sections,
-    const context::ordinary_assembly_context& ord_ctx,
-    bool include_all_sections)
+const lsp_context::symbol_index& lsp_context::get_symbol_index() const
 {
-    std::vector<std::pair<const context::symbol*, context::id_index>> reachable_symbols;
+    if (m_symbol_index)
+        return *m_symbol_index;
+
+    auto index = std::make_unique<symbol_index>();
 
-    for (const auto& [name, symv] : ord_ctx.symbols())
+    for (const auto& [name, symv] : m_hlasm_ctx->ord_ctx.symbols())
     {
         const auto* sym = std::get_if<context::symbol>(&symv);
         if (!sym)
@@ -441,7 +433,7 @@ std::vector<std::pair<const context::symbol*, context::id_index>> compute_reacha
 
         if (sym->kind() == context::symbol_value_kind::ABS)
         {
-            reachable_symbols.emplace_back(sym, context::id_index());
+            index->absolute.emplace_back(sym);
             continue;
         }
 
@@ -452,12 +444,50 @@ std::vector<std::pair<const context::symbol*, context::id_index>> compute_reacha
         if (!reloc.is_simple())
             continue;
 
-        for (const auto& [sect, label] : reachable_sections)
-        {
-            if (sect != reloc.bases().front().owner)
-                continue;
+        index->relocatable[reloc.bases().front().owner].emplace_back(sym);
+    }
+
+    m_symbol_index = std::move(index);
+
+    return *m_symbol_index;
+}
+
+const std::vector<const macro_info*>& lsp_context::get_macro_index() const
+{
+    if (m_macro_index)
+        return *m_macro_index;
+
+    auto index = std::make_unique<std::vector<const macro_info*>>();
+    index->reserve(m_macros.size());
+    for (const auto& [_, m] : m_macros)
+        index->emplace_back(m.get());
+    std::ranges::sort(*index, {}, [](const auto* m) { return m->macro_definition->id.to_string_view(); });
+
+    m_macro_index = std::move(index);
+
+    return *m_macro_index;
+}
+
+namespace {
+std::vector<std::pair<const context::symbol*, context::id_index>> compute_reachable_symbol_set(
+    const std::vector<std::pair<const context::section*, context::id_index>>& reachable_sections,
+    const context::ordinary_assembly_context& ord_ctx,
+    const std::vector<const context::symbol*>& absolute,
+    const std::unordered_map<const context::section*, std::vector<const context::symbol*>>& relocatable,
+    bool include_all_sections)
+{
+    std::vector<std::pair<const context::symbol*, context::id_index>> reachable_symbols;
+
+    for (const auto* sym : absolute)
+        reachable_symbols.emplace_back(sym, context::id_index());
+
+    for (const auto& [sect, label] : reachable_sections)
+    {
+        const auto it = relocatable.find(sect);
+        if (it == relocatable.end())
+            continue;
+        for (const auto* sym : it->second)
             reachable_symbols.emplace_back(sym, label);
-        }
     }
 
     if (include_all_sections)
@@ -479,6 +509,33 @@ std::vector<std::pair<const context::symbol*, context::id_index>> compute_reacha
     return reachable_symbols;
 }
 
+// the part of the operand typed so far
+std::string_view operand_prefix(const text_data_view& text, position pos)
+{
+    static constexpr std::string_view symbol_chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789@#$_.";
+
+    std::string_view line_so_far = text.get_line_beginning_at(pos);
+    if (const auto start = line_so_far.find_last_not_of(symbol_chars); start != std::string_view::npos)
+        line_so_far.remove_prefix(start + 1);
+
+    return line_so_far;
+}
+
+bool matches_prefix(std::string_view prefix, const std::pair<const context::symbol*, context::id_index>& s)
+{
+    const auto& [sym, label] = s;
+    if (matches_completion_prefix(prefix, sym->name().to_string_view()))
+        return true;
+    if (label.empty())
+        return false;
+
+    std::string qualified;
+    qualified.append(label.to_string_view()).append(".").append(sym->name().to_string_view());
+    return matches_completion_prefix(prefix, qualified);
+}
+} // namespace
+
 completion_list_source lsp_context::completion(const utils::resource::resource_location& document_uri,
     position pos,
     const char32_t trigger_char,
@@ -509,7 +566,12 @@ completion_list_source lsp_context::completion(const utils::resource::resource_l
 
         auto reachable_sections = gather_reachable_sections(*m_hlasm_ctx, { section, usings });
 
-        auto reachable_symbols = compute_reachable_symbol_set(reachable_sections, m_hlasm_ctx->ord_ctx, is_using);
+        const auto& [absolute, relocatable] = get_symbol_index();
+        auto reachable_symbols = compute_reachable_symbol_set(
+            reachable_sections, m_hlasm_ctx->ord_ctx, absolute, relocatable, is_using);
+
+        if (const auto prefix = operand_prefix(text, pos); !prefix.empty())
+            std::erase_if(reachable_symbols, [prefix](const auto& s) { return !matches_prefix(prefix, s); });
 
         return std::pair(instr ? instr->opcode : nullptr, std::move(reachable_symbols));
     }
@@ -549,15 +611,15 @@ completion_list_source lsp_context::complete_instr(const file_info& fi, position
         value.completed_text.remove_prefix(completion_start + 1);
     }
 
-    value.macros = &m_macros;
+    value.macros = &get_macro_index();
 
     return result;
 }
 
-void lsp_context::distribute_file_occurrences(const file_occurrences_t& occurrences)
+void lsp_context::distribute_file_occurrences(const macro_info& macro_i)
 {
-    for (auto& [file, occs] : occurrences)
-        m_files.at(file).update_occurrences(occs.symbols, occs.line_details);
+    for (const auto& [file, occs] : macro_i.file_occurrences)
+        m_files.at(file).update_occurrences(occs.symbols, occs.line_details, &macro_i);
 }
 
 occurrence_scope_t lsp_context::find_occurrence_with_scope(
@@ -565,7 +627,7 @@ occurrence_scope_t lsp_context::find_occurrence_with_scope(
 {
     if (auto file = m_files.find(document_loc); file != m_files.end())
         return file->second.find_occurrence_with_scope(pos);
-    return std::make_pair(nullptr, nullptr);
+    return {};
 }
 
 const line_occurence_details* lsp_context::find_line_details(
@@ -16,6 +16,7 @@
 #define LSP_CONTEXT_H
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -43,6 +44,8 @@ class parse_lib_provider;
 
 namespace hlasm_plugin::parser_library::context {
 class hlasm_context;
+class section;
+class symbol;
 } // namespace hlasm_plugin::parser_library::context
 
 namespace hlasm_plugin::parser_library::lsp {
@@ -78,12 +81,31 @@ class lsp_context final
 
     std::vector<title_details> m_titles;
 
+    // ordinary symbols usable in operands grouped by the section they are relative to
+    struct symbol_index
+    {
+        std::vector<const context::symbol*> absolute;
+        std::unordered_map<const context::section*, std::vector<const context::symbol*>> relocatable;
+    };
+    // built on the first operand completion request, the analysis is finished by then
+    mutable std::unique_ptr<const symbol_index> m_symbol_index;
+
+    const symbol_index& get_symbol_index() const;
+
+    // macros sorted by name for instruction completion, built on the first request as well
+    mutable std::unique_ptr<const std::vector<const macro_info*>> m_macro_index;
+
+    const std::vector<const macro_info*>& get_macro_index() const;
+
 public:
     explicit lsp_context(std::shared_ptr<context::hlasm_context> h_ctx);
 
     void add_copy(context::copy_member_ptr copy, text_data_view text_data);
     void add_macro(macro_info_ptr macro_i, text_data_view text_data = text_data_view());
-    void add_opencode(opencode_info_ptr opencode_i, text_data_view text_data, parse_lib_provider& libs);
+    void add_opencode(opencode_info_ptr opencode_i,
+        const file_occurrences_t& occurrences,
+        text_data_view text_data,
+        parse_lib_provider& libs);
     void add_title(std::string title, context::processing_stack_t stack);
 
     [[nodiscard]] macro_info_ptr get_macro_info(
@@ -91,6 +113,9 @@ public:
     [[nodiscard]] const file_info* get_file_info(const utils::resource::resource_location& file_loc) const;
 
     location definition(const utils::resource::resource_location& document_loc, position pos) const;
+    // name of the ordinary symbol at the position
+    std::optional<context::id_index> ordinary_symbol(
+        const utils::resource::resource_location& document_loc, position pos) const;
     std::vector<location> references(const utils::resource::resource_location& document_loc, position pos) const;
     std::string hover(
         const utils::resource::resource_location& document_loc, position pos, const utils::text_convertor* tc) const;
@@ -107,7 +132,7 @@ public:
     std::vector<branch_info> get_opencode_branch_info() const;
 
 private:
-    void distribute_file_occurrences(const file_occurrences_t& occurrences);
+    void distribute_file_occurrences(const macro_info& macro_i);
 
     occurrence_scope_t find_occurrence_with_scope(
         const utils::resource::resource_location& document_loc, position pos) const;
@@ -19,6 +19,7 @@
 
 #include "context/macro.h"
 #include "context/statement_id.h"
+#include "occurrence_index.h"
 #include "symbol_occurrence.h"
 #include "tagged_index.h"
 
@@ -131,6 +132,15 @@ struct file_occur_value
 
 using file_occurrences_t = std::unordered_map<utils::resource::resource_location, file_occur_value>;
 
+// occurrences of a finished macro definition are kept in the compact form
+struct indexed_file_occurrences
+{
+    occurrence_index symbols;
+    std::vector<line_occurence_details> line_details;
+};
+
+using indexed_file_occurrences_t = std::unordered_map<utils::resource::resource_location, indexed_file_occurrences>;
+
 class lsp_context;
 
 struct macro_info
@@ -140,7 +150,7 @@ struct macro_info
     context::macro_def_ptr macro_definition;
     vardef_storage var_definitions;
     file_scopes_t file_scopes;
-    file_occurrences_t file_occurrences;
+    indexed_file_occurrences_t file_occurrences;
 
     macro_info(bool external,
         location definition_location,
@@ -153,8 +163,14 @@ struct macro_info
         , macro_definition(std::move(macro_definition))
         , var_definitions(std::move(var_definitions))
         , file_scopes(std::move(file_scopes))
-        , file_occurrences(std::move(file_occurrences))
-    {}
+    {
+        for (auto& [file, occs] : file_occurrences)
+        {
+            auto& indexed = this->file_occurrences[file];
+            indexed.symbols.assign(std::move(occs.symbols));
+            indexed.line_details = std::move(occs.line_details);
+        }
+    }
 };
 
 using macro_info_ptr = std::shared_ptr<macro_info>;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "occurrence_index.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <tuple>
+
+namespace hlasm_plugin::parser_library::lsp {
+
+template<typename T, typename Occurrence, typename Scope>
+void occurrence_index::assign_impl(std::vector<T>& occurrences, Occurrence occurrence, Scope scope)
+{
+    std::ranges::sort(occurrences, {}, [&occurrence](const auto& e) {
+        const auto& occ = occurrence(e);
+        return std::tie(occ.occurrence_range.end.line, occ.occurrence_range.start.line, occ.evaluated_model);
+    });
+
+    *this = {};
+
+    const auto n = occurrences.size();
+    m_kinds.reserve(n);
+    m_evaluated_model.reserve(n);
+    m_names.reserve(n);
+    m_start_line_deltas.reserve(n);
+    m_start_columns.reserve(n);
+    m_end_columns.reserve(n);
+
+    const size_t line_count = n ? occurrence(occurrences.back()).occurrence_range.end.line + 1 : 0;
+    m_line_offsets.reserve(line_count + 1);
+
+    for (const auto& e : occurrences)
+    {
+        const auto& occ = occurrence(e);
+        const auto& [start, end] = occ.occurrence_range;
+        while (m_line_offsets.size() <= end.line)
+            m_line_offsets.push_back((std::uint32_t)m_kinds.size());
+
+        if (occ.opcode)
+            m_opcodes.emplace_back((std::uint32_t)m_kinds.size(), occ.opcode);
+        if (const auto* s = scope(e); s && occ.is_scoped())
+            m_scopes.emplace_back((std::uint32_t)m_kinds.size(), s);
+        m_kinds.push_back(occ.kind);
+        m_evaluated_model.push_back(occ.evaluated_model);
+        m_names.push_back(occ.name);
+        m_start_line_deltas.push_back((std::uint32_t)(end.line - start.line));
+        m_start_columns.push_back((std::uint32_t)start.column);
+        m_end_columns.push_back((std::uint32_t)end.column);
+    }
+    m_line_offsets.push_back((std::uint32_t)m_kinds.size());
+
+    m_start_limits.resize(line_count);
+    auto m = (std::uint32_t)-1;
+    for (size_t l = line_count; l-- > 0;)
+    {
+        for (auto i = m_line_offsets[l]; i < m_line_offsets[l + 1]; ++i)
+            m = std::min(m, (std::uint32_t)(l - m_start_line_deltas[i]));
+        m_start_limits[l] = m;
+    }
+
+    m_by_name.resize(n);
+    std::iota(m_by_name.begin(), m_by_name.end(), (std::uint32_t)0);
+    std::ranges::stable_sort(m_by_name, {}, [this](auto i) { return m_names[i]; });
+}
+
+void occurrence_index::assign(std::vector<symbol_occurrence> occurrences)
+{
+    static constexpr auto self = [](const symbol_occurrence& e) -> const symbol_occurrence& { return e; };
+    static constexpr auto no_scope = [](const symbol_occurrence&) -> const macro_info* { return nullptr; };
+    assign_impl(occurrences, self, no_scope);
+}
+
+void occurrence_index::assign(std::vector<scoped_occurrence> occurrences)
+{
+    assign_impl(occurrences, std::mem_fn(&scoped_occurrence::occurrence), std::mem_fn(&scoped_occurrence::scope));
+}
+
+size_t occurrence_index::end_line(size_t i) const noexcept
+{
+    return std::ranges::upper_bound(m_line_offsets, i) - m_line_offsets.begin() - 1;
+}
+
+const macro_info* occurrence_index::scope(size_t i) const noexcept
+{
+    if (auto it = std::ranges::lower_bound(m_scopes, i, {}, [](const auto& e) { return (size_t)e.first; });
+        it != m_scopes.end() && it->first == i)
+        return it->second;
+    return nullptr;
+}
+
+symbol_occurrence occurrence_index::get(size_t i, size_t end_line) const noexcept
+{
+    symbol_occurrence result(m_kinds[i], m_names[i], occurrence_range(i, end_line), m_evaluated_model[i]);
+    if (auto it = std::ranges::lower_bound(m_opcodes, i, {}, [](const auto& e) { return (size_t)e.first; });
+        it != m_opcodes.end() && it->first == i)
+        result.opcode = it->second;
+    return result;
+}
+
+void occurrence_index::find_similar(
+    const symbol_occurrence& occ, const macro_info* scope, std::vector<position>& result) const
+{
+    for (auto i : std::ranges::equal_range(m_by_name, occ.name, {}, [this](auto i) { return m_names[i]; }))
+    {
+        const auto candidate = get(i, end_line(i));
+        if (!occ.is_similar(candidate))
+            continue;
+        if (occ.is_scoped() && this->scope(i) != scope)
+            continue;
+        result.push_back(candidate.occurrence_range.start);
+    }
+}
+
+} // namespace hlasm_plugin::parser_library::lsp
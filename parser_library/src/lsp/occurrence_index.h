@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef LSP_OCCURRENCE_INDEX_H
+#define LSP_OCCURRENCE_INDEX_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "context/id_index.h"
+#include "range.h"
+#include "symbol_occurrence.h"
+
+namespace hlasm_plugin::parser_library::lsp {
+
+struct macro_info;
+
+// occurrence together with the macro it was found in (nullptr for the open code)
+struct scoped_occurrence
+{
+    symbol_occurrence occurrence;
+    const macro_info* scope = nullptr;
+};
+
+// Compact structure-of-arrays storage of symbol occurrences ordered by their end line.
+// The end line is implied by the per-line offset table, start lines are stored relative to it.
+class occurrence_index
+{
+    std::vector<occurrence_kind> m_kinds;
+    std::vector<bool> m_evaluated_model;
+    std::vector<context::id_index> m_names;
+    std::vector<std::uint32_t> m_start_line_deltas;
+    std::vector<std::uint32_t> m_start_columns;
+    std::vector<std::uint32_t> m_end_columns;
+    // only some INSTR occurrences refer to a macro
+    std::vector<std::pair<std::uint32_t, const context::macro_definition*>> m_opcodes;
+    // only scoped occurrences (variable and sequence symbols) found in macros need their scope
+    std::vector<std::pair<std::uint32_t, const macro_info*>> m_scopes;
+    // occurrences ordered by their name
+    std::vector<std::uint32_t> m_by_name;
+    // index of the first occurrence that ends on the line or later, one extra entry for the end
+    std::vector<std::uint32_t> m_line_offsets;
+    // the smallest start line of occurrences that end on the line or later
+    std::vector<std::uint32_t> m_start_limits;
+
+    template<typename T, typename Occurrence, typename Scope>
+    void assign_impl(std::vector<T>& occurrences, Occurrence occurrence, Scope scope);
+
+public:
+    void assign(std::vector<symbol_occurrence> occurrences);
+    void assign(std::vector<scoped_occurrence> occurrences);
+
+    size_t size() const noexcept { return m_kinds.size(); }
+    size_t lines() const noexcept { return m_start_limits.size(); }
+
+    // index of the first occurrence that ends on the line or later
+    size_t first_ending_at(size_t line) const noexcept
+    {
+        return line < m_line_offsets.size() ? m_line_offsets[line] : size();
+    }
+    size_t start_limit(size_t line) const noexcept { return m_start_limits[line]; }
+    size_t end_line(size_t i) const noexcept;
+
+    occurrence_kind kind(size_t i) const noexcept { return m_kinds[i]; }
+    context::id_index name(size_t i) const noexcept { return m_names[i]; }
+    bool evaluated_model(size_t i) const noexcept { return m_evaluated_model[i]; }
+    const macro_info* scope(size_t i) const noexcept;
+    range occurrence_range(size_t i, size_t end_line) const noexcept
+    {
+        return range(
+            position(end_line - m_start_line_deltas[i], m_start_columns[i]), position(end_line, m_end_columns[i]));
+    }
+    symbol_occurrence get(size_t i, size_t end_line) const noexcept;
+
+    // calls f(occurrence) for every occurrence in the index order
+    template<typename F>
+    void for_each(F&& f) const
+    {
+        for (size_t l = 0; l < lines(); ++l)
+            for (auto i = first_ending_at(l), e = first_ending_at(l + 1); i < e; ++i)
+                f(get(i, l));
+    }
+
+    // appends start positions of occurrences similar to the provided one
+    // scoped occurrences must also come from the same scope
+    void find_similar(const symbol_occurrence& occ, const macro_info* scope, std::vector<position>& result) const;
+};
+
+} // namespace hlasm_plugin::parser_library::lsp
+
+#endif
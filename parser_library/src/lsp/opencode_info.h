@@ -26,11 +26,9 @@ using opencode_info_ptr = std::unique_ptr<opencode_info>;
 struct opencode_info
 {
     vardef_storage variable_definitions;
-    file_occurrences_t file_occurrences;
 
-    opencode_info(vardef_storage variable_definitions, file_occurrences_t file_occurrences)
+    explicit opencode_info(vardef_storage variable_definitions)
         : variable_definitions(std::move(variable_definitions))
-        , file_occurrences(std::move(file_occurrences))
     {}
 };
 
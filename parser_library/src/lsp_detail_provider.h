@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPARSER_PARSERLIBRARY_LSP_DETAIL_PROVIDER_H
+#define HLASMPARSER_PARSERLIBRARY_LSP_DETAIL_PROVIDER_H
+
+namespace hlasm_plugin::utils::resource {
+class resource_location;
+} // namespace hlasm_plugin::utils::resource
+
+namespace hlasm_plugin::parser_library {
+// Decides which files receive complete LSP information (symbol occurrences, line details and macro slices).
+// Only a minimal index (definitions) is collected for the remaining ones, the open code is always complete.
+class lsp_detail_provider
+{
+protected:
+    ~lsp_detail_provider() = default;
+
+public:
+    virtual bool full_lsp_details(const utils::resource::resource_location& file) const = 0;
+};
+} // namespace hlasm_plugin::parser_library
+
+#endif
@@ -24,6 +24,7 @@
 #include "checking/data_definition/data_def_type_base.h"
 #include "context/hlasm_context.h"
 #include "context/literal_pool.h"
+#include "context/statement_arena.h"
 #include "context/well_known.h"
 #include "expressions/conditional_assembly/ca_expr_policy.h"
 #include "expressions/conditional_assembly/ca_expr_visitor.h"
@@ -59,6 +60,16 @@ parser_holder::parser_holder(context::hlasm_context& hl_ctx, diagnostic_op_consu
 
 parser_holder::~parser_holder() = default;
 
+void parser_holder::set_arena(std::shared_ptr<context::statement_arena> a)
+{
+    if (arena == a)
+        return;
+
+    // leftovers of the previous statement may still reside in the old arena
+    collector.prepare_for_next_statement();
+    arena = std::move(a);
+}
+
 void parser_holder::prepare_parser(lexing::u8string_view_with_newlines text,
     context::hlasm_context& hl_ctx,
     diagnostic_op_consumer* diags,
@@ -190,6 +201,8 @@ char_substitution parser_holder::reset(
     input.clear();
     newlines.clear();
     line_limits.clear();
+    // the buffers keep their capacity between statements
+    input.reserve(str.text.size() + 1);
     auto [subs, _] = append_utf8_with_newlines(input, newlines, line_limits, str.text);
 
     reset(file_offset, logical_column, process);
@@ -299,6 +312,12 @@ struct parser2
 
     ///////////////////////////////////////////////////////////////////
 
+    template<std::derived_from<context::arena_allocated> T, typename... Args>
+    [[nodiscard]] std::unique_ptr<T> make_node(Args&&... args) const
+    {
+        return context::make_arena_unique<T>(holder->get_arena(), std::forward<Args>(args)...);
+    }
+
     [[nodiscard]] constexpr bool is_ord_first() const noexcept { return char_is_ord_first(*input.next); }
     [[nodiscard]] constexpr bool is_ord() const noexcept { return char_is_ord(*input.next); }
     [[nodiscard]] constexpr bool is_num() const noexcept { return char_is_num(*input.next); }
@@ -459,7 +478,7 @@ struct parser2
 
     void add_hl_symbol(const range& r, hl_scopes s);
 
-    context::id_index parse_identifier(std::string value, range id_range) const;
+    context::id_index parse_identifier(std::string_view value, range id_range) const;
 
     context::id_index add_id(std::string value) const;
     context::id_index add_id(std::string_view value) const;
@@ -472,7 +491,8 @@ struct parser2
 
     void resolve_concat_chain(const semantics::concat_chain& chain) const;
 
-    std::string lex_ord();
+    // the result refers to the input buffer and is valid until the next reset
+    std::string_view lex_ord();
 
     std::string lex_ord_upper();
 
@@ -652,7 +672,8 @@ struct parser2
     std::optional<int> maybe_loctr_len();
 
     result_t<void> lex_deferred_string(std::vector<semantics::vs_ptr>& vs);
-    void op_rem_body_deferred();
+    result_t<void> lex_deferred_operands(std::vector<semantics::vs_ptr>& vs);
+    void op_rem_body_deferred(bool scan);
     void op_rem_body_noop();
 
     struct before_model
@@ -927,12 +948,12 @@ void parser2::syntax_error_or_eof() const
 
 void parser2::add_hl_symbol(const range& r, hl_scopes s) { holder->collector.add_hl_symbol(token_info(r, s)); }
 
-context::id_index parser2::parse_identifier(std::string value, range id_range) const
+context::id_index parser2::parse_identifier(std::string_view value, range id_range) const
 {
     if (value.size() > 63 && holder->diagnostic_collector)
         holder->diagnostic_collector->add_diagnostic(diagnostic_op::error_S100(value, id_range));
 
-    return holder->hlasm_ctx->add_id(std::move(value));
+    return holder->hlasm_ctx->add_id(value);
 }
 
 // TODO: This should be changed, so the id_index is always valid ordinary symbol
@@ -1088,28 +1109,23 @@ void parser2::resolve_concat_chain(const semantics::concat_chain& chain) const
         e.resolve(diags);
 }
 
-std::string parser2::lex_ord()
+std::string_view parser2::lex_ord()
 {
     assert(is_ord_first());
 
-    std::string result;
+    // ordinary symbols are ASCII and continuations do not interrupt the input buffer
+    const auto* const start = input.next;
     do
     {
-        consume_into(result);
+        consume();
     } while (is_ord());
 
-    return result;
+    return std::string_view(reinterpret_cast<const char*>(start), input.next - start);
 }
 
 std::string parser2::lex_ord_upper()
 {
-    assert(is_ord_first());
-
-    std::string result;
-    do
-    {
-        consume_into(result);
-    } while (is_ord());
+    std::string result(lex_ord());
 
     utils::to_upper(result);
 
@@ -1122,9 +1138,9 @@ result_t<context::id_index> parser2::lex_id()
 
     const auto start = cur_pos_adjusted();
 
-    std::string name = lex_ord();
+    const auto name = lex_ord();
 
-    auto id = parse_identifier(std::move(name), range_from(start));
+    auto id = parse_identifier(name, range_from(start));
     if (id.empty())
         return failure;
     else
@@ -1236,7 +1252,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr_general()
         consume();
         const auto r = range_from(start_not);
         add_hl_symbol(r, hl_scopes::operand);
-        ca_exprs.push_back(std::make_unique<expressions::ca_symbol>(context::id_index("NOT"), r));
+        ca_exprs.push_back(make_node<expressions::ca_symbol>(context::id_index("NOT"), r));
         lex_optional_space();
     } while (follows_NOT());
 
@@ -1245,7 +1261,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr_general()
         return failure;
 
     ca_exprs.push_back(std::move(e));
-    return std::make_unique<expressions::ca_expr_list>(std::move(ca_exprs), range_from(start), false);
+    return make_node<expressions::ca_expr_list>(std::move(ca_exprs), range_from(start), false);
 }
 
 result_t<semantics::concat_chain> parser2::lex_ca_string_value()
@@ -1514,7 +1530,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_rest_of_ca_string_group(
     if (error)
         return failure;
 
-    expressions::ca_expr_ptr result = std::make_unique<expressions::ca_string>(
+    expressions::ca_expr_ptr result = make_node<expressions::ca_string>(
         std::move(s.first), std::move(initial_duplicate_factor), std::move(s.second), range_from(start));
 
     while (follows<u8'(', u8'\''>())
@@ -1536,8 +1552,8 @@ result_t<expressions::ca_expr_ptr> parser2::lex_rest_of_ca_string_group(
         if (error2)
             return failure;
 
-        result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_conc>>(std::move(result),
-            std::make_unique<expressions::ca_string>(
+        result = make_node<expressions::ca_basic_binary_operator<expressions::ca_conc>>(std::move(result),
+            make_node<expressions::ca_string>(
                 std::move(s2.first), std::move(nested_dupl), std::move(s2.second), range_from(conc_start)),
             range_from(start));
     }
@@ -1599,7 +1615,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr_list()
     }
     if (!match<u8')'>(hl_scopes::operator_symbol, diagnostic_op::error_S0011))
         return failure;
-    return std::make_unique<expressions::ca_expr_list>(std::move(expr_list), range_from(start), true);
+    return make_node<expressions::ca_expr_list>(std::move(expr_list), range_from(start), true);
 }
 
 result_t<expressions::ca_expr_ptr> parser2::lex_self_def()
@@ -1614,7 +1630,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_self_def()
         return failure;
 
     const auto r = range_from(start);
-    return std::make_unique<expressions::ca_constant>(parse_self_def_term(std::string_view(&c, 1), std::move(s), r), r);
+    return make_node<expressions::ca_constant>(parse_self_def_term(std::string_view(&c, 1), std::move(s), r), r);
 }
 
 result_t<expressions::ca_expr_ptr> parser2::lex_attribute_reference()
@@ -1638,7 +1654,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_attribute_reference()
             // TODO: highlighting
             (void)try_consume<u8'.'>();
 
-            return std::make_unique<expressions::ca_symbol_attribute>(
+            return make_node<expressions::ca_symbol_attribute>(
                 std::move(v), attr, range_from(start), range_from(start_value));
         }
 
@@ -1650,7 +1666,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_attribute_reference()
             auto [error, l] = lex_literal();
             if (error)
                 return failure;
-            return std::make_unique<expressions::ca_symbol_attribute>(
+            return make_node<expressions::ca_symbol_attribute>(
                 std::move(l), attr, range_from(start), range_from(start_value));
         }
 
@@ -1666,7 +1682,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_attribute_reference()
                 return failure;
             const auto id_r = range_from(id_start);
             add_hl_symbol(id_r, hl_scopes::ordinary_symbol);
-            return std::make_unique<expressions::ca_symbol_attribute>(id, attr, range_from(start), id_r);
+            return make_node<expressions::ca_symbol_attribute>(id, attr, range_from(start), id_r);
         }
     }
 }
@@ -1696,7 +1712,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
             auto [error, v] = lex_variable();
             if (error)
                 return failure;
-            return std::make_unique<expressions::ca_var_sym>(std::move(v), range_from(start));
+            return make_node<expressions::ca_var_sym>(std::move(v), range_from(start));
         }
 
         case u8'-':
@@ -1733,7 +1749,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
             const auto already_expr_list =
                 std::holds_alternative<std::vector<expressions::ca_expr_ptr>>(maybe_expr_list.value);
             if (already_expr_list)
-                p_expr = std::make_unique<expressions::ca_expr_list>(
+                p_expr = make_node<expressions::ca_expr_list>(
                     std::move(std::get<std::vector<expressions::ca_expr_ptr>>(maybe_expr_list.value)),
                     range_from(start),
                     true);
@@ -1763,7 +1779,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
                 auto [s_error, s] = lex_subscript_ne();
                 if (s_error)
                     return failure;
-                return std::make_unique<expressions::ca_function>(id,
+                return make_node<expressions::ca_function>(id,
                     expressions::ca_common_expr_policy::get_function(id.to_string_view()),
                     std::move(s),
                     std::move(p_expr),
@@ -1774,7 +1790,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
             {
                 std::vector<expressions::ca_expr_ptr> ops;
                 ops.push_back(std::move(p_expr));
-                p_expr = std::make_unique<expressions::ca_expr_list>(std::move(ops), range_from(start), true);
+                p_expr = make_node<expressions::ca_expr_list>(std::move(ops), range_from(start), true);
             }
 
             return p_expr;
@@ -1815,7 +1831,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
                 auto [error2, s] = lex_subscript_ne();
                 if (error2)
                     return failure;
-                return std::make_unique<expressions::ca_function>(id,
+                return make_node<expressions::ca_function>(id,
                     expressions::ca_common_expr_policy::get_function(id.to_string_view()),
                     std::move(s),
                     expressions::ca_expr_ptr(),
@@ -1825,7 +1841,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term()
             {
                 const auto r = range_from(start);
                 add_hl_symbol(r, hl_scopes::operand);
-                return std::make_unique<expressions::ca_symbol>(id, r);
+                return make_node<expressions::ca_symbol>(id, r);
             }
     }
 }
@@ -1873,7 +1889,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_num()
     if (error)
         return failure;
     const auto& [v, r] = number;
-    return std::make_unique<expressions::ca_constant>(v, r);
+    return make_node<expressions::ca_constant>(v, r);
 }
 
 result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
@@ -1892,12 +1908,12 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                 return failure;
             if (!match<u8')'>(hl_scopes::operator_symbol, diagnostic_op::error_S0011))
                 return failure;
-            return std::make_unique<expressions::mach_expr_unary<expressions::par>>(std::move(e), range_from(start));
+            return make_node<expressions::mach_expr_unary<expressions::par>>(std::move(e), range_from(start));
         }
 
         case u8'*':
             consume(hl_scopes::operand);
-            return std::make_unique<expressions::mach_expr_location_counter>(range_from(start));
+            return make_node<expressions::mach_expr_location_counter>(range_from(start));
 
         case u8'-':
         case u8'0':
@@ -1914,14 +1930,14 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
             if (error)
                 return failure;
             const auto& [v, r] = number;
-            return std::make_unique<expressions::mach_expr_constant>(parse_self_def_term_in_mach("D", v, r), r);
+            return make_node<expressions::mach_expr_constant>(parse_self_def_term_in_mach("D", v, r), r);
         }
 
         case u8'=': {
             auto [error, l] = lex_literal();
             if (error)
                 return failure;
-            return std::make_unique<expressions::mach_expr_literal>(range_from(start), std::move(l));
+            return make_node<expressions::mach_expr_literal>(range_from(start), std::move(l));
         }
 
         default:
@@ -1941,7 +1957,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                     return failure;
                 }
                 consume(hl_scopes::operand);
-                return std::make_unique<expressions::mach_expr_constant>(loctr_len.value(), range_from(start));
+                return make_node<expressions::mach_expr_constant>(loctr_len.value(), range_from(start));
             }
             if (follows<mach_attrs, group<u8'\''>>())
             {
@@ -1956,8 +1972,8 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                     if (error)
                         return failure;
 
-                    return std::make_unique<expressions::mach_expr_data_attr_literal>(
-                        std::make_unique<expressions::mach_expr_literal>(range_from(start_value), std::move(l)),
+                    return make_node<expressions::mach_expr_data_attr_literal>(
+                        make_node<expressions::mach_expr_literal>(range_from(start_value), std::move(l)),
                         attr,
                         range_from(start),
                         range_from(start_value));
@@ -1969,7 +1985,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                         return failure;
                     const auto r = range_from(start_value);
                     add_hl_symbol(r, hl_scopes::ordinary_symbol);
-                    return std::make_unique<expressions::mach_expr_data_attr>(
+                    return make_node<expressions::mach_expr_data_attr>(
                         q_id.id, q_id.qual, attr, range_from(start), r);
                 }
                 syntax_error_or_eof();
@@ -1986,7 +2002,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                     return failure;
 
                 const auto r = range_from(start);
-                return std::make_unique<expressions::mach_expr_constant>(
+                return make_node<expressions::mach_expr_constant>(
                     parse_self_def_term_in_mach(std::string_view(opt, 2), s, r), r);
             }
             if (follows<selfdef, group<u8'\''>>())
@@ -1998,7 +2014,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
                     return failure;
 
                 const auto r = range_from(start);
-                return std::make_unique<expressions::mach_expr_constant>(
+                return make_node<expressions::mach_expr_constant>(
                     parse_self_def_term_in_mach(std::string_view(&opt, 1), s, r), r);
             }
             if (auto [error, qual_id] = lex_qualified_id(); error)
@@ -2007,7 +2023,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term()
             {
                 const auto r = range_from(start);
                 add_hl_symbol(r, hl_scopes::ordinary_symbol);
-                return std::make_unique<expressions::mach_expr_symbol>(qual_id.id, qual_id.qual, r);
+                return make_node<expressions::mach_expr_symbol>(qual_id.id, qual_id.qual, r);
             }
     }
 }
@@ -2060,9 +2076,9 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_term_c()
         if (error)
             return failure;
         if (plus)
-            return std::make_unique<expressions::mach_expr_unary<expressions::add>>(std::move(e), range_from(start));
+            return make_node<expressions::mach_expr_unary<expressions::add>>(std::move(e), range_from(start));
         else
-            return std::make_unique<expressions::mach_expr_unary<expressions::sub>>(std::move(e), range_from(start));
+            return make_node<expressions::mach_expr_unary<expressions::sub>>(std::move(e), range_from(start));
     }
 
     return lex_mach_term();
@@ -2083,10 +2099,10 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_expr_s()
             if (error2)
                 return failure;
             if (mul)
-                e = std::make_unique<expressions::mach_expr_binary<expressions::mul>>(
+                e = make_node<expressions::mach_expr_binary<expressions::mul>>(
                     std::move(e), std::move(next), range_from(start));
             else
-                e = std::make_unique<expressions::mach_expr_binary<expressions::div>>(
+                e = make_node<expressions::mach_expr_binary<expressions::div>>(
                     std::move(e), std::move(next), range_from(start));
         }
         return std::move(e);
@@ -2108,10 +2124,10 @@ result_t<expressions::mach_expr_ptr> parser2::lex_mach_expr()
             if (error2)
                 return failure;
             if (plus)
-                e = std::make_unique<expressions::mach_expr_binary<expressions::add>>(
+                e = make_node<expressions::mach_expr_binary<expressions::add>>(
                     std::move(e), std::move(next), range_from(start));
             else
-                e = std::make_unique<expressions::mach_expr_binary<expressions::sub>>(
+                e = make_node<expressions::mach_expr_binary<expressions::sub>>(
                     std::move(e), std::move(next), range_from(start));
         }
         return std::move(e);
@@ -2189,7 +2205,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_literal_signed_num()
     auto [error, n] = parse_number();
     if (error)
         return failure;
-    return std::make_unique<expressions::mach_expr_constant>(n.first, n.second);
+    return make_node<expressions::mach_expr_constant>(n.first, n.second);
 }
 
 result_t<expressions::mach_expr_ptr> parser2::lex_literal_unsigned_num()
@@ -2211,7 +2227,7 @@ result_t<expressions::mach_expr_ptr> parser2::lex_literal_unsigned_num()
     auto [error, n] = parse_number();
     if (error)
         return failure;
-    return std::make_unique<expressions::mach_expr_constant>(n.first, n.second);
+    return make_node<expressions::mach_expr_constant>(n.first, n.second);
 }
 
 result_t<expressions::data_definition> parser2::lex_data_def_base()
@@ -2412,7 +2428,7 @@ result_t<semantics::literal_si> parser2::lex_literal()
         // continue processing
     }
 
-    return holder->collector.add_literal(capture_text(initial), std::move(dd), range_from(start));
+    return holder->collector.add_literal(capture_text(initial), std::move(dd), range_from(start), holder->arena);
 }
 
 result_t<expressions::ca_expr_ptr> parser2::lex_term_c()
@@ -2426,9 +2442,9 @@ result_t<expressions::ca_expr_ptr> parser2::lex_term_c()
         if (error)
             return failure;
         if (plus)
-            return std::make_unique<expressions::ca_plus_operator>(std::move(e), range_from(start));
+            return make_node<expressions::ca_plus_operator>(std::move(e), range_from(start));
         else
-            return std::make_unique<expressions::ca_minus_operator>(std::move(e), range_from(start));
+            return make_node<expressions::ca_minus_operator>(std::move(e), range_from(start));
     }
     return lex_term();
 }
@@ -2450,10 +2466,10 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr_s()
         if (error2)
             return failure;
         if (mult)
-            result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_mul>>(
+            result = make_node<expressions::ca_basic_binary_operator<expressions::ca_mul>>(
                 std::move(result), std::move(e_next), range_from(start));
         else
-            result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_div>>(
+            result = make_node<expressions::ca_basic_binary_operator<expressions::ca_div>>(
                 std::move(result), std::move(e_next), range_from(start));
     }
 
@@ -2482,10 +2498,10 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr()
                 if (error)
                     return failure;
                 if (plus)
-                    result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_add>>(
+                    result = make_node<expressions::ca_basic_binary_operator<expressions::ca_add>>(
                         std::move(result), std::move(e), range_from(start));
                 else
-                    result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_sub>>(
+                    result = make_node<expressions::ca_basic_binary_operator<expressions::ca_sub>>(
                         std::move(result), std::move(e), range_from(start));
             }
             break;
@@ -2495,7 +2511,7 @@ result_t<expressions::ca_expr_ptr> parser2::lex_expr()
                 auto [error, e] = lex_term_c();
                 if (error)
                     return failure;
-                result = std::make_unique<expressions::ca_basic_binary_operator<expressions::ca_conc>>(
+                result = make_node<expressions::ca_basic_binary_operator<expressions::ca_conc>>(
                     std::move(result), std::move(e), range_from(start));
             }
             break;
@@ -2798,12 +2814,12 @@ std::pair<semantics::operand_list, range> parser2::macro_ops(bool reparse)
         {
             if (last && result.empty())
                 return;
-            result.push_back(std::make_unique<semantics::empty_operand>(range_from(start)));
+            result.push_back(make_node<semantics::empty_operand>(range_from(start)));
         }
         else
         {
             resolve_concat_chain(cc);
-            result.push_back(std::make_unique<semantics::macro_operand>(std::move(cc), range_from(start)));
+            result.push_back(make_node<semantics::macro_operand>(std::move(cc), range_from(start)));
         }
     };
 
@@ -3041,7 +3057,7 @@ std::pair<semantics::operand_list, range> parser2::ca_args()
         if (try_consume<u8','>(hl_scopes::operator_symbol))
         {
             if (pending)
-                result.push_back(std::make_unique<semantics::empty_operand>(empty_range(start)));
+                result.push_back(make_node<semantics::empty_operand>(empty_range(start)));
             process_optional_line_remark();
             pending = true;
             continue;
@@ -3055,14 +3071,14 @@ std::pair<semantics::operand_list, range> parser2::ca_args()
         if (op)
             result.push_back(std::move(op));
         else if (continue_loop && (!result.empty() || follows<u8','>()))
-            result.push_back(std::make_unique<semantics::empty_operand>(empty_range(start)));
+            result.push_back(make_node<semantics::empty_operand>(empty_range(start)));
         pending = false;
 
         if (!continue_loop)
             break;
     }
     if (pending)
-        result.push_back(std::make_unique<semantics::empty_operand>(cur_pos_range()));
+        result.push_back(make_node<semantics::empty_operand>(cur_pos_range()));
 
     consume_rest();
 
@@ -3078,11 +3094,11 @@ std::pair<bool, semantics::operand_ptr> parser2::ca_expr_ops(parser_position sta
         // original fallback
         return {
             false,
-            std::make_unique<semantics::expr_ca_operand>(std::make_unique<expressions::ca_constant>(0, r), r),
+            make_node<semantics::expr_ca_operand>(make_node<expressions::ca_constant>(0, r), r),
         };
     }
     resolve_expression(expr, i);
-    return { true, std::make_unique<semantics::expr_ca_operand>(std::move(expr), range_from(start)) };
+    return { true, make_node<semantics::expr_ca_operand>(std::move(expr), range_from(start)) };
 }
 
 std::pair<bool, semantics::operand_ptr> parser2::ca_branch_ops(parser_position start, size_t i)
@@ -3101,9 +3117,9 @@ std::pair<bool, semantics::operand_ptr> parser2::ca_branch_ops(parser_position s
         return {};
     const auto r = range_from(start);
     if (first_expr)
-        return { true, std::make_unique<semantics::branch_ca_operand>(std::move(ss), std::move(first_expr), r) };
+        return { true, make_node<semantics::branch_ca_operand>(std::move(ss), std::move(first_expr), r) };
     else
-        return { true, std::make_unique<semantics::seq_ca_operand>(std::move(ss), r) };
+        return { true, make_node<semantics::seq_ca_operand>(std::move(ss), r) };
 }
 
 std::pair<bool, semantics::operand_ptr> parser2::ca_var_def_ops(parser_position start, size_t)
@@ -3140,7 +3156,7 @@ std::pair<bool, semantics::operand_ptr> parser2::ca_var_def_ops(parser_position
         resolve_concat_chain(cc);
         var = std::make_unique<semantics::created_variable_symbol>(std::move(cc), std::move(num), r);
     }
-    return { true, std::make_unique<semantics::var_ca_operand>(std::move(var), r) };
+    return { true, make_node<semantics::var_ca_operand>(std::move(var), r) };
 }
 
 semantics::operand_list parser_holder::macro_ops(bool reparse)
@@ -3190,7 +3206,7 @@ semantics::operand_ptr parser_holder::ca_op_expr()
         return nullptr;
 
     p.resolve_expression(expr, 0);
-    return std::make_unique<semantics::expr_ca_operand>(std::move(expr), p.range_from(start));
+    return p.make_node<semantics::expr_ca_operand>(std::move(expr), p.range_from(start));
 }
 
 void parser2::lab_instr_process()
@@ -3557,7 +3573,7 @@ void parser2::lex_handle_label(semantics::concat_chain cc, range r)
             label.append(std::get<semantics::char_str_conc>(c.value).value);
 
         add_hl_symbol(r, hl_scopes::seq_symbol);
-        holder->collector.set_label_field({ parse_identifier(std::move(label), r), r }, r);
+        holder->collector.set_label_field({ parse_identifier(label, r), r }, r);
     }
     else if (is_ord_like(cc))
     {
@@ -3609,12 +3625,12 @@ parser_holder::op_data parser2::look_lab_instr_seq()
     if (!is_ord_first())
         return lab_instr_empty(start);
 
-    std::string label = lex_ord();
+    const auto label = lex_ord();
 
     const auto seq_end = cur_pos();
 
     const auto label_r = remap_range(start, seq_end);
-    auto seq_symbol = semantics::seq_sym { parse_identifier(std::move(label), label_r), label_r };
+    auto seq_symbol = semantics::seq_sym { parse_identifier(label, label_r), label_r };
     holder->collector.set_label_field(seq_symbol, label_r);
 
     if (!lex_optional_space() || !is_ord_first())
@@ -3625,7 +3641,7 @@ parser_holder::op_data parser2::look_lab_instr_seq()
         return {};
     }
     const auto instr_start = cur_pos_adjusted();
-    std::string instr = lex_ord();
+    const auto instr = lex_ord();
     const auto instr_end = cur_pos();
 
     if (!eof() && !follows<u8' '>())
@@ -3638,7 +3654,7 @@ parser_holder::op_data parser2::look_lab_instr_seq()
 
     const auto instr_r = remap_range(instr_start, instr_end);
 
-    holder->collector.set_instruction_field(parse_identifier(std::move(instr), instr_r), instr_r);
+    holder->collector.set_instruction_field(parse_identifier(instr, instr_r), instr_r);
 
     auto result = lab_instr_rest();
 
@@ -3651,7 +3667,7 @@ parser_holder::op_data parser2::look_lab_instr()
 {
     const auto start = cur_pos_adjusted();
 
-    std::string label;
+    std::string_view label;
     range label_r = empty_range(start);
     switch (*input.next)
     {
@@ -3683,12 +3699,10 @@ parser_holder::op_data parser2::look_lab_instr()
     if (!eof() && !follows<u8' '>())
         return lab_instr_empty(start);
 
+    // lookahead needs only the identifier, the mixed case spelling is used when the statement is processed
     if (!label.empty())
-    {
-        const auto id = add_id(label);
-        holder->collector.set_label_field(semantics::ord_symbol_string { id, std::move(label) }, label_r);
-    }
-    holder->collector.set_instruction_field(parse_identifier(std::move(instr), instr_r), instr_r);
+        holder->collector.set_label_field(semantics::ord_symbol_string { add_id(label), {} }, label_r);
+    holder->collector.set_instruction_field(parse_identifier(instr, instr_r), instr_r);
 
     auto result = lab_instr_rest();
 
@@ -3762,25 +3776,8 @@ result_t<void> parser2::lex_deferred_string(std::vector<semantics::vs_ptr>& vs)
     }
 }
 
-void parser2::op_rem_body_deferred()
+result_t<void> parser2::lex_deferred_operands(std::vector<semantics::vs_ptr>& vs)
 {
-    const auto start = cur_pos_adjusted();
-    if (eof())
-    {
-        holder->collector.set_operand_remark_field(empty_range(start));
-        return;
-    }
-    if (!follows<u8' '>())
-    {
-        syntax_error_or_eof();
-        return;
-    }
-    consume_spaces();
-
-    auto rest = parser2(*this).lab_instr_rest();
-
-    std::vector<semantics::vs_ptr> vs;
-
     bool next_char_special = true;
 
     while (!eof())
@@ -3810,7 +3807,7 @@ void parser2::op_rem_body_deferred()
 
             case u8'\'':
                 if (auto [error] = lex_deferred_string(vs); error)
-                    return;
+                    return failure;
                 break;
 
             case u8'&':
@@ -3819,7 +3816,7 @@ void parser2::op_rem_body_deferred()
                     case EOF_SYMBOL:
                         consume();
                         add_diagnostic(diagnostic_op::error_S0003);
-                        return;
+                        return failure;
 
                     case u8'&':
                         consume();
@@ -3828,7 +3825,7 @@ void parser2::op_rem_body_deferred()
 
                     default:
                         if (auto [error, v] = lex_variable(); error)
-                            return;
+                            return failure;
                         else
                             vs.push_back(std::move(v));
                         break;
@@ -3868,15 +3865,54 @@ void parser2::op_rem_body_deferred()
             }
         }
     }
+    return {};
+}
+
+void parser2::op_rem_body_deferred(bool scan)
+{
+    const auto start = cur_pos_adjusted();
+    if (eof())
+    {
+        holder->collector.set_operand_remark_field(empty_range(start));
+        return;
+    }
+    if (!follows<u8' '>())
+    {
+        syntax_error_or_eof();
+        return;
+    }
+    consume_spaces();
+
+    auto rest = parser2(*this).lab_instr_rest();
+
+    if (!scan)
+    {
+        holder->collector.set_operand_remark_field(std::move(*rest.op_text), rest.op_range, rest.op_logical_column);
+        return;
+    }
+
+    std::vector<semantics::vs_ptr> vs;
+
+    if (auto [error] = lex_deferred_operands(vs); error)
+        return;
+
     holder->collector.set_operand_remark_field(
         std::move(*rest.op_text), std::move(vs), std::move(remarks), rest.op_range, rest.op_logical_column);
 }
 
-void parser_holder::op_rem_body_deferred()
+void parser_holder::op_rem_body_deferred(bool scan)
 {
     parser2 p(this);
 
-    p.op_rem_body_deferred();
+    p.op_rem_body_deferred(scan);
+}
+
+bool parser_holder::scan_deferred_operands()
+{
+    parser2 p(this);
+
+    std::vector<semantics::vs_ptr> vs;
+    return !p.lex_deferred_operands(vs).error;
 }
 
 void parser2::op_rem_body_noop()
@@ -4082,7 +4118,7 @@ result_t<std::optional<semantics::op_rem>> parser2::try_model_ops(parser_positio
                 ccb.push_last_text();
                 semantics::concatenation_point::clear_concat_chain(cc);
                 resolve_concat_chain(cc);
-                result.operands.emplace_back(std::make_unique<semantics::model_operand>(
+                result.operands.emplace_back(make_node<semantics::model_operand>(
                     std::move(cc), holder->line_limits, remap_range(start, *operand_end)));
                 return result;
             }
@@ -4157,7 +4193,7 @@ result_t<semantics::operand_ptr> parser2::mach_op()
         return failure;
 
     if (!try_consume<u8'('>(hl_scopes::operator_symbol))
-        return std::make_unique<semantics::machine_operand>(std::move(disp), nullptr, nullptr, range_from(start));
+        return make_node<semantics::machine_operand>(std::move(disp), nullptr, nullptr, range_from(start));
 
     expressions::mach_expr_ptr e1, e2;
     if (eof())
@@ -4186,7 +4222,7 @@ result_t<semantics::operand_ptr> parser2::mach_op()
     if (!match<u8')'>(hl_scopes::operator_symbol, diagnostic_op::error_S0011))
         return failure;
 
-    return std::make_unique<semantics::machine_operand>(
+    return make_node<semantics::machine_operand>(
         std::move(disp), std::move(e1), std::move(e2), range_from(start));
 }
 
@@ -4198,7 +4234,7 @@ result_t<semantics::operand_ptr> parser2::dat_op()
     auto [error, d] = lex_data_definition(false);
     if (error)
         return failure;
-    return std::make_unique<semantics::data_def_operand_inline>(std::move(d), range_from(start));
+    return make_node<semantics::data_def_operand_inline>(std::move(d), range_from(start));
 }
 
 template<typename EmptyOperand,
@@ -4232,7 +4268,7 @@ std::optional<semantics::op_rem> parser2::with_model(bool reparse, bool model_al
     if (follows<u8','>())
     {
         if constexpr (rest != nullptr)
-            operands.push_back(std::make_unique<EmptyOperand>(cur_pos_range()));
+            operands.push_back(make_node<EmptyOperand>(cur_pos_range()));
     }
     else if (auto [error, op] = (this->*first)(); !(has_error = error))
         operands.push_back(std::move(op));
@@ -4247,15 +4283,15 @@ std::optional<semantics::op_rem> parser2::with_model(bool reparse, bool model_al
     {
         consume(hl_scopes::operator_symbol);
         if (follows<u8','>())
-            operands.push_back(std::make_unique<EmptyOperand>(cur_pos_range()));
+            operands.push_back(make_node<EmptyOperand>(cur_pos_range()));
         else if (eof() || follows<u8' '>())
         {
-            operands.push_back(std::make_unique<EmptyOperand>(cur_pos_range()));
+            operands.push_back(make_node<EmptyOperand>(cur_pos_range()));
             break;
         }
         else if (auto [error_inner, op_inner] = (this->*rest)(); error_inner)
         {
-            operands.push_back(std::make_unique<EmptyOperand>(cur_pos_range()));
+            operands.push_back(make_node<EmptyOperand>(cur_pos_range()));
             break;
         }
         else
@@ -4309,8 +4345,8 @@ result_t<semantics::operand_ptr> parser2::alias_op()
     const auto r = range_from(start);
     add_hl_symbol(r, hl_scopes::self_def_type);
 
-    return std::make_unique<semantics::expr_assembler_operand>(
-        std::make_unique<expressions::mach_expr_default>(r), capture_text(initial), r);
+    return make_node<semantics::expr_assembler_operand>(
+        make_node<expressions::mach_expr_default>(r), capture_text(initial), r);
 }
 
 result_t<semantics::operand_ptr> parser2::end_op()
@@ -4357,7 +4393,7 @@ result_t<semantics::operand_ptr> parser2::end_op()
     add_hl_symbol(r3, hl_scopes::operand);
 
     const auto r = range_from(start);
-    return std::make_unique<semantics::complex_assembler_operand>("", std::move(language_triplet), r);
+    return make_node<semantics::complex_assembler_operand>("", std::move(language_triplet), r);
 }
 
 result_t<semantics::operand_ptr> parser2::using_op1()
@@ -4378,7 +4414,7 @@ result_t<semantics::operand_ptr> parser2::using_op1()
             return failure;
 
         const auto r = range_from(start);
-        return std::make_unique<semantics::expr_assembler_operand>(
+        return make_node<semantics::expr_assembler_operand>(
             std::move(e1), utils::to_upper_copy(capture_text(initial1, end1)), r);
     }
 
@@ -4392,7 +4428,7 @@ result_t<semantics::operand_ptr> parser2::using_op1()
         return failure;
 
     const auto r = range_from(start);
-    return std::make_unique<semantics::using_instr_assembler_operand>(
+    return make_node<semantics::using_instr_assembler_operand>(
         std::move(e1), std::move(e2), capture_text(initial1, end1), capture_text(initial2, end2), r);
 }
 
@@ -4406,7 +4442,7 @@ result_t<semantics::operand_ptr> parser2::asm_mach_expr()
         return failure;
 
     const auto r = range_from(start);
-    return std::make_unique<semantics::expr_assembler_operand>(
+    return make_node<semantics::expr_assembler_operand>(
         std::move(expr), utils::to_upper_copy(capture_text(initial)), r);
 }
 
@@ -4501,7 +4537,7 @@ result_t<semantics::operand_ptr> parser2::asm_op()
         auto [error, s] = lex_simple_string();
         if (error)
             return failure;
-        return std::make_unique<semantics::string_assembler_operand>(std::move(s), range_from(start));
+        return make_node<semantics::string_assembler_operand>(std::move(s), range_from(start));
     }
 
     if (!ord_followed_by_parenthesis())
@@ -4521,7 +4557,7 @@ result_t<semantics::operand_ptr> parser2::asm_op()
         return failure;
 
     const auto r = range_from(start);
-    return std::make_unique<semantics::complex_assembler_operand>(std::move(id), std::move(nested), r);
+    return make_node<semantics::complex_assembler_operand>(std::move(id), std::move(nested), r);
 }
 
 std::optional<semantics::op_rem> parser_holder::op_rem_body_asm(
@@ -4604,7 +4640,7 @@ void parser2::lookahead_operands_and_remarks_asm()
         while (except<u8',', u8' '>())
             consume();
         if (follows<u8','>())
-            operands.push_back(std::make_unique<semantics::empty_operand>(empty_range(op_start)));
+            operands.push_back(make_node<semantics::empty_operand>(empty_range(op_start)));
     }
     else
         operands.push_back(std::move(op));
@@ -4615,14 +4651,14 @@ void parser2::lookahead_operands_and_remarks_asm()
         op_start = cur_pos_adjusted();
         if (follows<u8',', u8' '>())
         {
-            operands.push_back(std::make_unique<semantics::empty_operand>(empty_range(op_start)));
+            operands.push_back(make_node<semantics::empty_operand>(empty_range(op_start)));
             continue;
         }
         auto [error, op] = asm_op();
         if (error || errors)
         {
             errors = true;
-            operands.push_back(std::make_unique<semantics::empty_operand>(empty_range(op_start)));
+            operands.push_back(make_node<semantics::empty_operand>(empty_range(op_start)));
             while (except<u8',', u8' '>())
                 consume();
         }
@@ -16,6 +16,7 @@
 #define HLASMPLUGIN_PARSERLIBRARY_PARSER_IMPL_H
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -27,6 +28,7 @@
 
 namespace hlasm_plugin::parser_library::context {
 class hlasm_context;
+class statement_arena;
 } // namespace hlasm_plugin::parser_library::context
 
 namespace hlasm_plugin::parser_library::lexing {
@@ -84,11 +86,19 @@ class parser_holder
     input_state_t input_state;
     bool process_allowed = false;
 
+    // must outlive the objects held by the collector
+    std::shared_ptr<context::statement_arena> arena;
+
 public:
     semantics::collector collector;
 
     void set_diagnostic_collector(diagnostic_op_consumer* d) { diagnostic_collector = d; }
 
+    // operands and expressions of the following statements are allocated in the arena (on the heap when null),
+    // the statements extracted from the collector must keep it alive
+    void set_arena(std::shared_ptr<context::statement_arena> a);
+    context::statement_arena* get_arena() const noexcept { return arena.get(); }
+
     parser_holder(context::hlasm_context& hl_ctx, diagnostic_op_consumer* d);
     virtual ~parser_holder();
 
@@ -103,7 +113,10 @@ public:
     op_data look_lab_instr();
 
     void op_rem_body_noop();
-    void op_rem_body_deferred();
+    // without scanning, the operand field is only captured and no variable symbols are collected
+    void op_rem_body_deferred(bool scan = true);
+    // validates a captured deferred operand field, returns false if it is not usable
+    bool scan_deferred_operands();
     void lookahead_operands_and_remarks_asm();
     void lookahead_operands_and_remarks_dat();
 
@@ -113,6 +113,7 @@ struct asm_processor::handler_table
         { id_index("DXD"), fn<&asm_processor::process_DXD> },
         { id_index("EXTRN"), fn<&asm_processor::process_EXTRN> },
         { id_index("WXTRN"), fn<&asm_processor::process_WXTRN> },
+        { id_index("ENTRY"), fn<&asm_processor::process_ENTRY> },
         { id_index("ORG"), fn<&asm_processor::process_ORG> },
         { id_index("OPSYN"), fn<&asm_processor::process_OPSYN> },
         { id_index("AINSERT"), fn<&asm_processor::process_AINSERT> },
@@ -611,6 +612,26 @@ void asm_processor::process_external(rebuilt_statement&& stmt, external_type t)
         std::move(dep_solver).derive_current_dependency_evaluation_context());
 }
 
+void asm_processor::process_ENTRY(rebuilt_statement&& stmt)
+{
+    for (const auto& op : stmt.operands_ref().value)
+    {
+        const auto* op_asm = op->access_asm();
+        if (!op_asm)
+            continue;
+        const auto* expr = op_asm->access_expr();
+        if (!expr)
+            continue;
+        if (const auto* sym = dynamic_cast<const expressions::mach_expr_symbol*>(expr->expression.get()))
+            hlasm_ctx.ord_ctx.add_entry_point(sym->value);
+    }
+
+    context::ordinary_assembly_dependency_solver dep_solver(hlasm_ctx.ord_ctx, lib_info);
+    hlasm_ctx.ord_ctx.symbol_dependencies().add_postponed_statement(
+        std::make_unique<postponed_statement_impl>(std::move(stmt), hlasm_ctx.processing_stack()),
+        std::move(dep_solver).derive_current_dependency_evaluation_context());
+}
+
 void asm_processor::process_ORG(rebuilt_statement&& stmt)
 {
     find_sequence_symbol(stmt);
@@ -16,9 +16,11 @@
 
 #include <algorithm>
 #include <format>
+#include <numeric>
 
 #include "analyzer.h"
 #include "context/hlasm_context.h"
+#include "context/statement_arena.h"
 #include "context/well_known.h"
 #include "library_info_transitional.h"
 #include "lsp/lsp_context.h"
@@ -28,6 +30,7 @@
 #include "semantics/collector.h"
 #include "semantics/range_provider.h"
 #include "semantics/source_info_processor.h"
+#include "utils/string_operations.h"
 #include "utils/text_matchers.h"
 #include "utils/unicode_text.h"
 
@@ -67,6 +70,7 @@ opencode_provider::~opencode_provider() = default;
 utils::task opencode_provider::start_preprocessor()
 {
     m_input_document = co_await m_preprocessor->generate_replacement(std::move(m_input_document));
+    m_lookahead_prescan.clear();
 }
 
 void opencode_provider::onetime_action()
@@ -330,7 +334,8 @@ std::shared_ptr<const context::hlasm_statement> opencode_provider::process_looka
         collector.append_operand_field(std::move(h.collector));
     }
     range statement_range(position(m_current_logical_line_source.begin_line, 0)); // assign default
-    auto result = collector.extract_statement(proc_status, statement_range);
+    auto result =
+        collector.extract_statement(proc_status, statement_range, m_ctx.hlasm_ctx->current_statement_arena());
 
     if (m_current_logical_line.segments.size() > 1)
         m_ctx.hlasm_ctx->metrics.continued_statements++;
@@ -391,7 +396,7 @@ std::shared_ptr<const context::hlasm_statement> opencode_provider::process_ordin
                 case processing_form::IGNORED:
                     break;
                 case processing_form::DEFERRED:
-                    h.op_rem_body_deferred();
+                    h.op_rem_body_deferred(!m_opts.capture_macro_operands || proc.kind != processing_kind::MACRO);
                     break;
                 case processing_form::CA_GENERIC:
                     h.op_rem_body_ca_expr();
@@ -444,7 +449,8 @@ std::shared_ptr<const context::hlasm_statement> opencode_provider::process_ordin
         }
     }
     range statement_range(position(m_current_logical_line_source.begin_line, 0)); // assign default
-    auto result = collector.extract_statement(proc_status, statement_range);
+    auto result =
+        collector.extract_statement(proc_status, statement_range, m_ctx.hlasm_ctx->current_statement_arena());
 
     if (proc.kind == processing_kind::ORDINARY
         && try_trigger_attribute_lookahead(*result,
@@ -638,12 +644,18 @@ context::shared_stmt_ptr opencode_provider::get_next(const statement_processor&
         m_restart_process_ordinary.reset();
         return result;
     }
-    auto ll_res = extract_next_logical_line();
+    const bool lookahead = proc.kind == processing_kind::LOOKAHEAD;
+
+    const auto& arena = m_ctx.hlasm_ctx->current_statement_arena();
+    m_parsers.m_parser->set_arena(arena);
+    m_parsers.m_lookahead_parser->set_arena(arena);
+    m_parsers.m_operand_parser->set_arena(arena);
+
+    auto ll_res = extract_next_logical_line(lookahead);
     if (ll_res == extract_next_logical_line_result::failed)
         return nullptr;
     const bool is_process = ll_res == extract_next_logical_line_result::process;
 
-    const bool lookahead = proc.kind == processing_kind::LOOKAHEAD;
     const bool nested = proc.kind == processing_kind::MACRO || proc.kind == processing_kind::COPY;
 
     auto& ph = lookahead ? *m_parsers.m_lookahead_parser : *m_parsers.m_parser;
@@ -685,13 +697,15 @@ context::shared_stmt_ptr opencode_provider::get_next(const statement_processor&
             for (auto& diag : ph.collector.diag_container().diags)
                 m_diagnoser->add_diagnostic(std::move(diag));
             // indicate errors were produced, but do not report them again
-            return std::make_shared<error_statement>(
-                range(position(m_current_logical_line_source.begin_line, 0)), std::vector<diagnostic_op>());
+            return context::make_arena_shared<error_statement>(m_ctx.hlasm_ctx->current_statement_arena(),
+                range(position(m_current_logical_line_source.begin_line, 0)),
+                std::vector<diagnostic_op>());
         }
         else if (lookahead)
             return nullptr;
         else
-            return std::make_shared<error_statement>(range(position(m_current_logical_line_source.begin_line, 0)),
+            return context::make_arena_shared<error_statement>(m_ctx.hlasm_ctx->current_statement_arena(),
+                range(position(m_current_logical_line_source.begin_line, 0)),
                 std::move(ph.collector.diag_container().diags));
     }
 
@@ -740,7 +754,7 @@ parsing::parser_holder& opencode_provider::parser()
 {
     if (!m_line_fed)
     {
-        auto ll_res = extract_next_logical_line();
+        auto ll_res = extract_next_logical_line(false);
         feed_line(*m_parsers.m_parser, ll_res == extract_next_logical_line_result::process, true);
     }
     assert(m_line_fed);
@@ -840,7 +854,7 @@ extract_next_logical_line_result opencode_provider::extract_next_logical_line_fr
     return extract_next_logical_line_result::failed; // next round
 }
 
-extract_next_logical_line_result opencode_provider::extract_next_logical_line()
+extract_next_logical_line_result opencode_provider::extract_next_logical_line(bool lookahead)
 {
     bool ictl_allowed = false;
     if (m_opts.ictl_allowed)
@@ -864,6 +878,9 @@ extract_next_logical_line_result opencode_provider::extract_next_logical_line()
             return extract_next_logical_line_from_copy_buffer();
     }
 
+    if (lookahead && !ictl_allowed && !m_opts.process_remaining)
+        skip_to_lookahead_candidate();
+
     if (m_next_line_index >= m_input_document.size())
         return extract_next_logical_line_result::failed;
 
@@ -929,6 +946,159 @@ extract_next_logical_line_result opencode_provider::extract_next_logical_line()
     return extract_next_logical_line_result::normal;
 }
 
+namespace {
+constexpr context::id_index lookahead_instructions[] = {
+    context::well_known::COPY,
+    context::well_known::END,
+    context::well_known::MACRO,
+    context::well_known::MEND,
+};
+
+bool is_lookahead_instruction(context::id_index id)
+{
+    return std::ranges::find(lookahead_instructions, id) != std::end(lookahead_instructions);
+}
+
+enum class lookahead_relevance
+{
+    none, // comments
+    skipped,
+    relevant,
+    macro,
+};
+
+// lookahead processes statements with a label and the instructions that change how the source is read,
+// everything else is decided only from the first line of the statement
+lookahead_relevance lookahead_relevance_of(std::string_view code, bool continued)
+{
+    using enum lookahead_relevance;
+
+    if (code.starts_with('*') || code.starts_with(".*"))
+        return none;
+    if (!code.empty() && code.front() != ' ')
+        return relevant;
+
+    const auto op_start = code.find_first_not_of(' ');
+    if (op_start == std::string_view::npos)
+        return continued ? relevant : skipped;
+    code.remove_prefix(op_start);
+
+    const auto op_end = code.find(' ');
+    if (op_end == std::string_view::npos && continued)
+        return relevant;
+    const auto op = code.substr(0, op_end);
+
+    // variable symbols and instruction tags
+    if (op.find_first_of("&:") != std::string_view::npos)
+        return relevant;
+
+    const auto it = std::ranges::find_if(lookahead_instructions, [op](context::id_index id) {
+        return std::ranges::equal(op, id.to_string_view(), {}, [](unsigned char c) { return utils::upper_cased[c]; });
+    });
+    if (it == std::end(lookahead_instructions))
+        return skipped;
+
+    return *it == context::well_known::MACRO ? macro : relevant;
+}
+} // namespace
+
+void opencode_provider::prescan_for_lookahead()
+{
+    // the prescan must start at a statement boundary, lines before it are never skipped
+    m_lookahead_prescan.resize(m_input_document.size() + 1);
+    for (size_t i = 0; i < m_lookahead_prescan.size(); ++i)
+        m_lookahead_prescan[i] = { i, i + 1, false };
+
+    lexing::logical_line<utils::utf8_iterator<std::string_view::iterator, utils::utf8_utf16_counter>> ll;
+    std::vector<size_t> pending;
+    bool macro_prototype = false;
+    for (size_t i = m_next_line_index; i < m_input_document.size();)
+    {
+        const auto start = i;
+        auto relevance = lookahead_relevance::relevant;
+        if (!m_input_document.at(i).is_original())
+        {
+            // processed by the preprocessor as a whole
+            while (i < m_input_document.size() && !m_input_document.at(i).is_original())
+                ++i;
+        }
+        else
+        {
+            ll.clear();
+            while (i < m_input_document.size())
+            {
+                if (const auto text = m_input_document.at(i++).text(); !append_to_logical_line(ll,
+                        utils::utf8_iterator<std::string_view::iterator, utils::utf8_utf16_counter>(text.begin()),
+                        text.end(),
+                        lexing::default_ictl))
+                    break;
+            }
+            finish_logical_line(ll, lexing::default_ictl);
+
+            const auto& first = ll.segments.front();
+            relevance = lookahead_relevance_of(
+                std::string_view(first.code.base(), first.continuation.base()), ll.segments.size() > 1);
+        }
+
+        // the prototype statement is needed to track the macro definitions
+        if (relevance == lookahead_relevance::skipped && macro_prototype)
+            relevance = lookahead_relevance::relevant;
+        if (relevance != lookahead_relevance::none)
+            macro_prototype = relevance == lookahead_relevance::macro;
+
+        m_lookahead_prescan[start].statement_end = i;
+        m_lookahead_prescan[start].skipped = relevance == lookahead_relevance::skipped;
+
+        if (relevance == lookahead_relevance::relevant || relevance == lookahead_relevance::macro)
+        {
+            for (auto p : pending)
+                m_lookahead_prescan[p].next_relevant = start;
+            pending.clear();
+        }
+        else
+            pending.push_back(start);
+    }
+    for (auto p : pending)
+        m_lookahead_prescan[p].next_relevant = m_input_document.size();
+}
+
+bool opencode_provider::lookahead_instruction_aliased()
+{
+    const auto gen = m_ctx.hlasm_ctx->current_opcode_generation();
+    if (m_lookahead_alias_check == gen)
+        return m_lookahead_instruction_aliased;
+
+    m_lookahead_alias_check = gen;
+    m_lookahead_instruction_aliased =
+        gen != context::opcode_generation::zero
+        && std::ranges::any_of(m_ctx.hlasm_ctx->opcode_mnemo_storage(), [](const auto& e) {
+               const auto& [name, versions] = e;
+               return !versions.empty() && is_lookahead_instruction(versions.back().first.opcode)
+                   && !is_lookahead_instruction(name);
+           });
+
+    return m_lookahead_instruction_aliased;
+}
+
+void opencode_provider::skip_to_lookahead_candidate()
+{
+    if (m_next_line_index >= m_input_document.size() || lookahead_instruction_aliased())
+        return;
+
+    if (m_lookahead_prescan.empty())
+        prescan_for_lookahead();
+
+    const auto target = m_lookahead_prescan[m_next_line_index].next_relevant;
+    for (auto i = m_next_line_index; i < target; i = m_lookahead_prescan[i].statement_end)
+    {
+        if (!m_lookahead_prescan[i].skipped)
+            continue;
+        const auto first_line = m_input_document.at(i).lineno().value();
+        m_processing_manager.lookahead_skip_cb(first_line, first_line + m_lookahead_prescan[i].statement_end - i - 1);
+    }
+    m_next_line_index = target;
+}
+
 parsing::parser_holder& opencode_provider::prepare_operand_parser(lexing::u8string_view_with_newlines text,
     context::hlasm_context& hlasm_ctx,
     diagnostic_op_consumer* diags,
@@ -18,6 +18,7 @@
 #include <concepts>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include <variant>
 #include <vector>
 
+#include "context/opcode_generation.h"
 #include "context/source_snapshot.h"
 #include "lexing/logical_line.h"
 #include "lexing/string_with_newlines.h"
@@ -74,6 +76,9 @@ struct opencode_provider_options
 {
     bool ictl_allowed;
     int process_remaining;
+    // operand fields of deferred statements in macro definitions are only captured,
+    // they are scanned when the statement is reached during a macro call
+    bool capture_macro_operands = false;
 };
 
 enum class extract_next_logical_line_result
@@ -162,6 +167,19 @@ class opencode_provider final : public statement_provider, virtual_file_monitor
 
     std::vector<context::id_index> lookahead_references;
 
+    // cheap prescan of the document, statements without a label that are not processed by lookahead
+    // are only reported to the analyzers, without being parsed
+    struct lookahead_prescan_entry
+    {
+        size_t next_relevant;
+        size_t statement_end;
+        bool skipped;
+    };
+    std::vector<lookahead_prescan_entry> m_lookahead_prescan;
+    // the prescan is not usable when OPSYN makes another mnemonic an alias of an instruction processed by lookahead
+    std::optional<context::opcode_generation> m_lookahead_alias_check;
+    bool m_lookahead_instruction_aliased = false;
+
     std::pair<virtual_file_handle, std::string_view> file_generated(std::string_view content) override;
 
 public:
@@ -202,7 +220,11 @@ private:
     bool is_next_line_process() const;
     void generate_continuation_error_messages(diagnostic_op_consumer* diags) const;
     extract_next_logical_line_result extract_next_logical_line_from_copy_buffer();
-    extract_next_logical_line_result extract_next_logical_line();
+    extract_next_logical_line_result extract_next_logical_line(bool lookahead);
+
+    void prescan_for_lookahead();
+    bool lookahead_instruction_aliased();
+    void skip_to_lookahead_candidate();
 
     parsing::parser_holder& prepare_operand_parser(lexing::u8string_view_with_newlines text,
         context::hlasm_context& hlasm_ctx,
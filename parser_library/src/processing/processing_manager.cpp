@@ -43,15 +43,18 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     statement_fields_parser& parser,
     std::shared_ptr<std::vector<fade_message>> fade_msgs,
     output_handler* output,
+    const lsp_detail_provider* lsp_details,
+    workspaces::io_worker_pool* check_pool,
     diagnosable_ctx& diag_ctx)
     : ctx_(ctx)
     , hlasm_ctx_(*ctx_.hlasm_ctx)
     , lib_provider_(lib_provider)
     , opencode_prov_(*base_provider)
     , diag_ctx(diag_ctx)
-    , lsp_analyzer_(*ctx_.hlasm_ctx, *ctx_.lsp_ctx, file_text)
+    , lsp_analyzer_(*ctx_.hlasm_ctx, *ctx_.lsp_ctx, file_text, lsp_details)
     , stms_analyzers_({ &lsp_analyzer_ })
     , file_loc_(file_loc)
+    , cancellable_(proc_kind == processing_kind::ORDINARY)
     , m_fade_msgs(std::move(fade_msgs))
 {
     switch (proc_kind)
@@ -60,7 +63,7 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
             provs_.emplace_back(
                 std::make_unique<macro_statement_provider>(ctx_, parser, lib_provider, *this, diag_ctx));
             procs_.emplace_back(std::make_unique<ordinary_processor>(
-                ctx_, *this, lib_provider, *this, parser, opencode_prov_, *this, output, diag_ctx));
+                ctx_, *this, lib_provider, *this, parser, opencode_prov_, *this, output, check_pool, diag_ctx));
             break;
         case processing_kind::COPY:
             start_copy_member(copy_start_data { ctx.hlasm_ctx->add_id(std::move(dep_name)), std::move(file_loc) });
@@ -135,6 +138,9 @@ utils::task processing_manager::co_step()
             proc.process_statement(std::move(stmt));
         }
 
+        if (cancellable_ && co_await utils::task::cancelled())
+            co_return;
+
         co_await utils::task::yield();
     }
 }
@@ -150,6 +156,12 @@ void processing_manager::aread_cb(size_t line, std::string_view text) const
         a->analyze_aread_line(file_loc_, line, text);
 }
 
+void processing_manager::lookahead_skip_cb(size_t first_line, size_t last_line) const
+{
+    for (auto& a : stms_analyzers_)
+        a->analyze_skipped_statement(file_loc_, first_line, last_line);
+}
+
 void processing_manager::run_analyzers(const context::hlasm_statement& statement, bool evaluated_model) const
 {
     run_analyzers(statement, find_provider().kind, procs_.back()->kind, evaluated_model);
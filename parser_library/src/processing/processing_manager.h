@@ -32,11 +32,15 @@
 #include "utils/task.h"
 
 namespace hlasm_plugin::parser_library {
+class lsp_detail_provider;
 class output_handler;
 } // namespace hlasm_plugin::parser_library
 namespace hlasm_plugin::parser_library::parsing {
 class parser_holder;
 } // namespace hlasm_plugin::parser_library::parsing
+namespace hlasm_plugin::parser_library::workspaces {
+class io_worker_pool;
+} // namespace hlasm_plugin::parser_library::workspaces
 
 namespace hlasm_plugin::parser_library::processing {
 
@@ -57,6 +61,8 @@ public:
         statement_fields_parser& parser,
         std::shared_ptr<std::vector<fade_message>> fade_msgs,
         output_handler* output,
+        const lsp_detail_provider* lsp_details,
+        workspaces::io_worker_pool* check_pool,
         diagnosable_ctx& diag_ctx);
 
     [[nodiscard]] utils::task co_step();
@@ -70,6 +76,7 @@ public:
         bool evaluated_model) const;
 
     void aread_cb(size_t line, std::string_view text) const;
+    void lookahead_skip_cb(size_t first_line, size_t last_line) const;
 
     void process_postponed_statements(const std::vector<
         std::pair<std::unique_ptr<context::postponed_statement>, context::dependency_evaluation_context>>& stmts);
@@ -92,6 +99,8 @@ private:
     std::vector<statement_analyzer*> stms_analyzers_;
 
     const utils::resource::resource_location file_loc_;
+    // only the analysis of the open code can be abandoned, library members are always processed completely
+    const bool cancellable_;
 
     context::source_snapshot lookahead_stop_;
     size_t lookahead_stop_ainsert_id = 0;
@@ -163,6 +163,25 @@ void hit_count_analyzer::analyze_aread_line(
     get_hc_entry_reference(rl).add(std::make_pair(lineno, lineno), true, false);
 }
 
+void hit_count_analyzer::analyze_skipped_statement(
+    const utils::resource::resource_location& rl, size_t first_line, size_t last_line)
+{
+    using enum statement_type;
+    const auto regular = m_next_stmt_type == REGULAR;
+    const auto macro = m_next_stmt_type == MACRO_BODY;
+    if (!regular && !macro)
+        return;
+
+    auto& hc_ref = get_hc_entry_reference(rl);
+
+    hc_ref.add(std::make_pair(first_line, last_line), false, macro);
+    if (regular)
+    {
+        if (auto mac_invo_loc = m_ctx.current_macro_definition_location(); mac_invo_loc)
+            hc_ref.emplace_prototype(mac_invo_loc->pos.line);
+    }
+}
+
 hit_count_map hit_count_analyzer::take_hit_count_map()
 {
     auto has_sections = !m_ctx.ord_ctx.sections().empty();
@@ -126,6 +126,9 @@ public:
 
     void analyze_aread_line(const utils::resource::resource_location& rl, size_t lineno, std::string_view) override;
 
+    void analyze_skipped_statement(
+        const utils::resource::resource_location& rl, size_t first_line, size_t last_line) override;
+
     hit_count_map take_hit_count_map();
 
 private:
@@ -27,6 +27,7 @@
 #include "context/well_known.h"
 #include "instructions/instruction.h"
 #include "library_info_transitional.h"
+#include "lsp_detail_provider.h"
 #include "lsp/lsp_context.h"
 #include "lsp/text_data_view.h"
 #include "occurrence_collector.h"
@@ -70,19 +71,77 @@ constexpr std::array<std::pair<context::id_index, context::SET_t_enum>, 3> SET_i
 
 } // namespace
 
-lsp_analyzer::lsp_analyzer(context::hlasm_context& hlasm_ctx, lsp::lsp_context& lsp_ctx, std::string_view file_text)
+lsp_analyzer::lsp_analyzer(context::hlasm_context& hlasm_ctx,
+    lsp::lsp_context& lsp_ctx,
+    std::string_view file_text,
+    const lsp_detail_provider* lsp_details)
     : hlasm_ctx_(hlasm_ctx)
     , lsp_ctx_(lsp_ctx)
     , file_text_(file_text)
+    , lsp_details_(lsp_details)
 {}
 
+bool lsp_analyzer::full_details(const utils::resource::resource_location& loc)
+{
+    if (!lsp_details_)
+        return true;
+
+    auto [it, inserted] = full_details_.try_emplace(loc, true);
+    if (inserted)
+        it->second = loc == hlasm_ctx_.opencode_location() || lsp_details_->full_lsp_details(loc);
+
+    return it->second;
+}
+
+void lsp_analyzer::analyze_minimal(const context::hlasm_statement& statement,
+    statement_provider_kind prov_kind,
+    processing_kind proc_kind,
+    bool evaluated_model)
+{
+    const auto* resolved_stmt = statement.access_resolved();
+    if (!resolved_stmt)
+        return;
+
+    switch (proc_kind)
+    {
+        case processing_kind::ORDINARY:
+            if (prov_kind == statement_provider_kind::COPY)
+            {
+                // references into copybooks remain available, only the line details are omitted
+                using enum lsp::occurrence_kind;
+                auto collection_info = get_active_collection(hlasm_ctx_.current_statement_source(), evaluated_model);
+                collect_references(ORD | INSTR | VAR | SEQ, *resolved_stmt, collection_info);
+                collect_copy_operands(*resolved_stmt, collection_info);
+            }
+            if (prov_kind != statement_provider_kind::MACRO)
+                collect_var_definition(*resolved_stmt);
+            if (resolved_stmt->opcode_ref().value == context::id_index("TITLE"))
+                collect_title(*resolved_stmt);
+            break;
+
+        case processing_kind::MACRO:
+            update_macro_nest(*resolved_stmt);
+            break;
+
+        default:
+            break;
+    }
+}
+
 bool lsp_analyzer::analyze(const context::hlasm_statement& statement,
     statement_provider_kind prov_kind,
     processing_kind proc_kind,
     bool evaluated_model)
 {
     using enum lsp::occurrence_kind;
-    auto collection_info = get_active_collection(hlasm_ctx_.current_statement_source(), evaluated_model);
+    const auto& stmt_source = hlasm_ctx_.current_statement_source();
+    if (!full_details(stmt_source))
+    {
+        analyze_minimal(statement, prov_kind, proc_kind, evaluated_model);
+        return false;
+    }
+
+    auto collection_info = get_active_collection(stmt_source, evaluated_model);
 
     const auto* resolved_stmt = statement.access_resolved();
     switch (proc_kind)
@@ -230,13 +289,15 @@ void lsp_analyzer::macrodef_finished(context::macro_def_ptr macrodef, macrodef_p
         // add instruction occurrence of macro name
         const auto& macro_file = md->definition_location.resource_loc;
 
+        macro_occurrences_[macro_file].symbols.emplace_back(md->id, md, result.prototype.macro_name_range);
+
+        // macro slices are only needed to resolve positions inside the macro file
         auto m_i = std::make_shared<lsp::macro_info>(result.external,
             location(result.prototype.macro_name_range.start, macro_file),
             std::move(macrodef),
             std::move(result.variable_symbols),
-            std::move(result.file_scopes),
+            full_details(macro_file) ? std::move(result.file_scopes) : lsp::file_scopes_t(),
             std::move(macro_occurrences_));
-        m_i->file_occurrences[macro_file].symbols.emplace_back(md->id, md, result.prototype.macro_name_range);
 
         if (result.external)
             lsp_ctx_.add_macro(std::move(m_i), lsp::text_data_view(file_text_));
@@ -255,10 +316,11 @@ void lsp_analyzer::copydef_finished(context::copy_member_ptr copydef, copy_proce
 
 void lsp_analyzer::opencode_finished(parse_lib_provider& libs)
 {
-    lsp_ctx_.add_opencode(
-        std::make_unique<lsp::opencode_info>(std::move(opencode_var_defs_), std::move(opencode_occurrences_)),
+    lsp_ctx_.add_opencode(std::make_unique<lsp::opencode_info>(std::move(opencode_var_defs_)),
+        opencode_occurrences_,
         lsp::text_data_view(file_text_),
         libs);
+    opencode_occurrences_.clear();
 }
 
 void lsp_analyzer::collect_occurrences(
@@ -296,6 +358,16 @@ void lsp_analyzer::collect_occurrences(
     }
 }
 
+void lsp_analyzer::collect_references(
+    lsp::occurrence_kind kind, const processing::resolved_statement& statement, const collection_info_t& ci)
+{
+    occurrence_collector collector(kind, hlasm_ctx_, *ci.stmt_occurrences, ci.evaluated_model);
+
+    collect_occurrence(statement.label_ref(), collector);
+    collect_occurrence(statement.instruction_ref(), collector, &statement.opcode_ref());
+    collect_occurrence(statement.operands_ref(), collector);
+}
+
 void lsp_analyzer::collect_occurrences(
     lsp::occurrence_kind kind, const semantics::preprocessor_statement_si& statement, const collection_info_t& ci)
 {
@@ -18,6 +18,7 @@
 #include <array>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 
 #include "context/common_types.h"
 #include "context/copy_member.h"
@@ -30,6 +31,7 @@
 
 namespace hlasm_plugin::parser_library {
 class library_info;
+class lsp_detail_provider;
 struct range;
 class parse_lib_provider;
 } // namespace hlasm_plugin::parser_library
@@ -75,6 +77,9 @@ class lsp_analyzer : public statement_analyzer
     lsp::lsp_context& lsp_ctx_;
     // text of the file this analyzer is assigned to
     std::string_view file_text_;
+    // files not accepted by the provider only get a minimal index
+    const lsp_detail_provider* lsp_details_;
+    std::unordered_map<utils::resource::resource_location, bool> full_details_;
 
     bool in_macro_ = false;
     size_t macro_nest_ = 1;
@@ -92,7 +97,10 @@ class lsp_analyzer : public statement_analyzer
     };
 
 public:
-    lsp_analyzer(context::hlasm_context& hlasm_ctx, lsp::lsp_context& lsp_ctx, std::string_view file_text);
+    lsp_analyzer(context::hlasm_context& hlasm_ctx,
+        lsp::lsp_context& lsp_ctx,
+        std::string_view file_text,
+        const lsp_detail_provider* lsp_details = nullptr);
 
     bool analyze(const context::hlasm_statement& statement,
         statement_provider_kind prov_kind,
@@ -101,6 +109,8 @@ public:
 
     void analyze_aread_line(const utils::resource::resource_location&, size_t, std::string_view) override {}
 
+    void analyze_skipped_statement(const utils::resource::resource_location&, size_t, size_t) override {}
+
     void analyze(const semantics::preprocessor_statement_si& statement);
 
     void macrodef_started(const macrodef_start_data& data);
@@ -116,8 +126,17 @@ public:
         const library_info& li);
 
 private:
+    bool full_details(const utils::resource::resource_location& loc);
+    void analyze_minimal(const context::hlasm_statement& statement,
+        statement_provider_kind prov_kind,
+        processing_kind proc_kind,
+        bool evaluated_model);
+
     void collect_occurrences(
         lsp::occurrence_kind kind, const context::hlasm_statement& statement, const collection_info_t& collection_info);
+    void collect_references(lsp::occurrence_kind kind,
+        const processing::resolved_statement& statement,
+        const collection_info_t& collection_info);
     void collect_occurrences(lsp::occurrence_kind kind,
         const semantics::preprocessor_statement_si& statement,
         const collection_info_t& collection_info);
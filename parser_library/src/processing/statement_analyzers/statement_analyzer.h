@@ -38,6 +38,10 @@ public:
     virtual void analyze_aread_line(
         const utils::resource::resource_location& rl, size_t lineno, std::string_view text) = 0;
 
+    // statement without a label that lookahead passed over without parsing it
+    virtual void analyze_skipped_statement(
+        const utils::resource::resource_location& rl, size_t first_line, size_t last_line) = 0;
+
 protected:
     ~statement_analyzer() = default;
 };
@@ -106,4 +106,23 @@ statement_fields_parser::parse_result statement_fields_parser::parse_operand_fie
     };
 }
 
+bool statement_fields_parser::scan_deferred_operand_field(lexing::u8string_view_with_newlines field,
+    semantics::range_provider field_range,
+    size_t logical_column,
+    diagnostic_op_consumer& add_diag)
+{
+    const auto original_range = field_range.original_range;
+
+    auto& h = *m_parser;
+    h.prepare_parser(field,
+        *m_hlasm_ctx,
+        &add_diag,
+        std::move(field_range),
+        original_range,
+        logical_column,
+        processing_status(processing_format(processing_kind::MACRO, processing_form::DEFERRED), op_code()));
+
+    return h.scan_deferred_operands();
+}
+
 } // namespace hlasm_plugin::parser_library::processing
@@ -59,6 +59,13 @@ public:
         processing::processing_status status,
         diagnostic_op_consumer& add_diag);
 
+    // deferred operand field that was only captured in the macro definition
+    // returns false if the field is not usable and the statement should be treated as having no operands
+    bool scan_deferred_operand_field(lexing::u8string_view_with_newlines field,
+        semantics::range_provider field_range,
+        size_t logical_column,
+        diagnostic_op_consumer& add_diag);
+
     explicit statement_fields_parser(context::hlasm_context& hlasm_ctx);
     ~statement_fields_parser();
 };
@@ -17,6 +17,7 @@
 #include <ranges>
 
 #include "context/hlasm_context.h"
+#include "context/statement_arena.h"
 #include "context/well_known.h"
 #include "instructions/instruction.h"
 #include "processing/branching_provider.h"
@@ -452,7 +453,8 @@ const processing_status empty_statement_t::status(
 bool macrodef_processor::process_COPY(const resolved_statement& statement)
 {
     // substitute copy for anop to not be processed again
-    result_.definition.push_back(std::make_shared<empty_statement_t>(statement.stmt_range_ref()));
+    result_.definition.push_back(context::make_arena_shared<empty_statement_t>(
+        ctx.hlasm_ctx->current_statement_arena(), statement.stmt_range_ref()));
     add_correct_copy_nest();
 
     if (auto extract = asm_processor::extract_copy_id(statement, nullptr); extract.has_value())
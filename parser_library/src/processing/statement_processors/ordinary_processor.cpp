@@ -14,7 +14,15 @@
 
 #include "ordinary_processor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <vector>
 
 #include "checking/data_check.h"
 #include "checking/diagnostic_collector.h"
@@ -36,6 +44,7 @@
 #include "semantics/operand_impls.h"
 #include "utils/projectors.h"
 #include "utils/truth_table.h"
+#include "workspaces/io_worker_pool.h"
 
 namespace hlasm_plugin::parser_library::processing {
 
@@ -47,6 +56,7 @@ ordinary_processor::ordinary_processor(const analyzing_context& ctx,
     opencode_provider& open_code,
     processing_manager& proc_mgr,
     output_handler* output,
+    workspaces::io_worker_pool* check_pool,
     diagnosable_ctx& diag_ctx)
     : statement_processor(processing_kind::ORDINARY, ctx, diag_ctx)
     , branch_provider_(branch_provider)
@@ -59,6 +69,7 @@ ordinary_processor::ordinary_processor(const analyzing_context& ctx,
     , finished_flag_(false)
     , listener_(state_listener)
     , proc_mgr(proc_mgr)
+    , check_pool_(check_pool)
 {}
 
 
@@ -333,67 +344,196 @@ bool transform_asm(std::vector<checking::check_op_ptr>& result,
     return true;
 }
 
-void ordinary_processor::check_postponed_statements(
-    const std::vector<std::pair<context::post_stmt_ptr, context::dependency_evaluation_context>>& stmts)
+struct operand_check_buffers
+{
+    std::vector<const checking::asm_operand*> asm_operands;
+    std::vector<checking::check_op_ptr> operands;
+};
+
+// returns false when the remaining statements should not be checked
+bool check_postponed_statement(const context::postponed_statement& stmt,
+    context::dependency_solver& dep_solver,
+    diagnostic_collector& collector,
+    operand_check_buffers& buffers)
 {
-    std::vector<const checking::asm_operand*> operand_asm_vector;
-    std::vector<const checking::machine_operand*> operand_mach_vector;
-    std::vector<checking::check_op_ptr> operand_vector;
+    const auto* rs = stmt.resolved_stmt;
 
-    for (const auto& [stmt, dep_ctx] : stmts)
+    const auto& opcode = rs->opcode_ref();
+    const auto instruction_name = opcode.value.to_string_view();
+    const auto& ops = rs->operands_ref().value;
+    const auto& stmt_range = rs->stmt_range_ref();
+
+    using enum context::instruction_type;
+    switch (opcode.type)
     {
-        if (!stmt)
-            continue;
+        case MACH:
+            checking::check_machine_instruction_operands(
+                *opcode.instr_mach, instruction_name, ops, stmt_range, dep_solver, collector);
+            break;
+
+        case MNEMO:
+            checking::check_mnemonic_code_operands(
+                *opcode.instr_mnemo, instruction_name, ops, stmt_range, dep_solver, collector);
+            break;
+
+        case ASM:
+            switch (opcode.instr_asm->data_def_type())
+            {
+                case instructions::data_def_instruction::DC_TYPE:
+                case instructions::data_def_instruction::DS_TYPE:
+                    checking::check_data_instruction_operands(
+                        *opcode.instr_asm, ops, stmt_range, dep_solver, collector);
+                    break;
+
+                case instructions::data_def_instruction::NONE:
+                    buffers.operands.clear();
+                    if (!transform_asm(buffers.operands, ops, *opcode.instr_asm, dep_solver, collector))
+                        return false;
+                    buffers.asm_operands.clear();
+                    for (const auto& op : buffers.operands)
+                        buffers.asm_operands.push_back(dynamic_cast<const checking::asm_operand*>(op.get()));
+                    checking::check_asm_ops(instruction_name, buffers.asm_operands, stmt_range, collector);
+                    break;
+            }
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+    return true;
+}
+
+// library lookups (O' attribute) reach the workspace, which expects a single thread
+class synchronized_library_info final : public library_info
+{
+    const library_info& m_base;
+    mutable std::mutex m_mutex;
+
+public:
+    explicit synchronized_library_info(const library_info& base)
+        : m_base(base)
+    {}
 
-        context::ordinary_assembly_dependency_solver dep_solver(hlasm_ctx.ord_ctx, dep_ctx, lib_info);
+    bool has_library(std::string_view member) const override
+    {
+        std::lock_guard g(m_mutex);
+        return m_base.has_library(member);
+    }
+};
 
-        const auto* rs = stmt->resolved_stmt;
-        diagnostic_collector collector(&diag_ctx, stmt->location_stack);
+// each statement is checked by a separate job that collects its own diagnostics, the jobs are taken in turns by the
+// analysis thread and by the pool threads, the analysis thread waits only for the jobs that have already been taken
+// queued pool jobs that start after all the statements were taken do nothing, so they may outlive the analysis
+struct operand_check_jobs
+{
+    struct result
+    {
+        std::vector<diagnostic_op> diags;
+        bool proceed = true;
+        std::exception_ptr error;
+    };
 
-        operand_vector.clear();
+    std::function<bool(size_t, diagnostic_collector&, operand_check_buffers&)> check;
+    std::vector<result> results;
 
-        const auto& opcode = rs->opcode_ref();
-        const auto instruction_name = opcode.value.to_string_view();
-        const auto& ops = rs->operands_ref().value;
-        const auto& stmt_range = rs->stmt_range_ref();
+    std::atomic<size_t> next_job = 0;
+    std::mutex mutex;
+    std::condition_variable all_done;
+    size_t completed = 0;
 
-        using enum context::instruction_type;
-        switch (opcode.type)
+    void work()
+    {
+        operand_check_buffers buffers;
+        size_t done = 0;
+        for (size_t i; (i = next_job.fetch_add(1, std::memory_order_acq_rel)) < results.size(); ++done)
         {
-            case MACH:
-                checking::check_machine_instruction_operands(
-                    *opcode.instr_mach, instruction_name, ops, stmt_range, dep_solver, collector);
-                break;
-
-            case MNEMO:
-                checking::check_mnemonic_code_operands(
-                    *opcode.instr_mnemo, instruction_name, ops, stmt_range, dep_solver, collector);
-                break;
-
-            case ASM:
-                switch (opcode.instr_asm->data_def_type())
-                {
-                    case instructions::data_def_instruction::DC_TYPE:
-                    case instructions::data_def_instruction::DS_TYPE:
-                        checking::check_data_instruction_operands(
-                            *opcode.instr_asm, ops, stmt_range, dep_solver, collector);
-                        break;
-
-                    case instructions::data_def_instruction::NONE:
-                        if (!transform_asm(operand_vector, ops, *opcode.instr_asm, dep_solver, collector))
-                            return;
-                        operand_asm_vector.clear();
-                        for (const auto& op : operand_vector)
-                            operand_asm_vector.push_back(dynamic_cast<const checking::asm_operand*>(op.get()));
-                        checking::check_asm_ops(instruction_name, operand_asm_vector, stmt_range, collector);
-                        break;
-                }
-                break;
-
-            default:
-                assert(false);
-                break;
+            auto& r = results[i];
+            try
+            {
+                diagnostic_collector collector(r.diags);
+                r.proceed = check(i, collector, buffers);
+            }
+            catch (...)
+            {
+                r.error = std::current_exception();
+            }
         }
+        if (!done)
+            return;
+
+        {
+            std::lock_guard g(mutex);
+            completed += done;
+        }
+        all_done.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock g(mutex);
+        all_done.wait(g, [this]() { return completed == results.size(); });
+    }
+};
+
+void ordinary_processor::check_postponed_statements(
+    const std::vector<std::pair<context::post_stmt_ptr, context::dependency_evaluation_context>>& stmts)
+{
+    if (!check_pool_ || !check_pool_->concurrency() || stmts.size() < PARALLEL_CHECK_THRESHOLD)
+    {
+        operand_check_buffers buffers;
+        for (const auto& [stmt, dep_ctx] : stmts)
+        {
+            if (!stmt)
+                continue;
+
+            context::ordinary_assembly_dependency_solver dep_solver(hlasm_ctx.ord_ctx, dep_ctx, lib_info);
+            diagnostic_collector collector(&diag_ctx, stmt->location_stack);
+
+            if (!check_postponed_statement(*stmt, dep_solver, collector, buffers))
+                return;
+        }
+        return;
+    }
+
+    // the layout is final at this point, the checks only read the context and the location counter values come from
+    // the dependency evaluation contexts captured when the statements were postponed
+    const synchronized_library_info lib(lib_info);
+
+    auto jobs = std::make_shared<operand_check_jobs>();
+    jobs->results.resize(stmts.size());
+    jobs->check = [this, &stmts, &lib](size_t i, diagnostic_collector& collector, operand_check_buffers& b) {
+        const auto& [stmt, dep_ctx] = stmts[i];
+        if (!stmt)
+            return true;
+
+        context::ordinary_assembly_dependency_solver dep_solver(hlasm_ctx.ord_ctx, dep_ctx, lib);
+        return check_postponed_statement(*stmt, dep_solver, collector, b);
+    };
+
+    const auto helpers = std::min<size_t>(check_pool_->concurrency(), stmts.size() / PARALLEL_CHECK_THRESHOLD);
+    for (size_t i = 0; i < helpers; ++i)
+        check_pool_->submit([jobs]() { jobs->work(); });
+
+    jobs->work();
+    jobs->wait();
+
+    // the diagnostics are reported in the order of the statements, as if they were checked sequentially
+    for (size_t i = 0; i < stmts.size(); ++i)
+    {
+        const auto& stmt = stmts[i].first;
+        if (!stmt)
+            continue;
+
+        auto& r = jobs->results[i];
+        const diagnostic_collector collector(&diag_ctx, stmt->location_stack);
+        for (auto& d : r.diags)
+            collector(std::move(d));
+
+        if (r.error)
+            std::rethrow_exception(r.error);
+        if (!r.proceed)
+            return;
     }
 }
 
@@ -29,6 +29,7 @@ struct postponed_statement;
 } // namespace hlasm_plugin::parser_library::context
 
 namespace hlasm_plugin::parser_library::workspaces {
+class io_worker_pool;
 class parse_lib_provider;
 } // namespace hlasm_plugin::parser_library::workspaces
 
@@ -40,6 +41,8 @@ class processing_state_listener;
 class ordinary_processor final : public statement_processor
 {
     static constexpr size_t NEST_LIMIT = 100;
+    // smaller sets of postponed statements are checked on the analysis thread only
+    static constexpr size_t PARALLEL_CHECK_THRESHOLD = 256;
 
     branching_provider& branch_provider_;
     library_info_transitional lib_info;
@@ -55,6 +58,8 @@ class ordinary_processor final : public statement_processor
     processing_state_listener& listener_;
     processing_manager& proc_mgr;
 
+    workspaces::io_worker_pool* check_pool_;
+
 public:
     ordinary_processor(const analyzing_context& ctx,
         branching_provider& branch_provider,
@@ -64,6 +69,7 @@ public:
         opencode_provider& open_code,
         processing_manager& proc_mgr,
         output_handler* output,
+        workspaces::io_worker_pool* check_pool,
         diagnosable_ctx& diag_ctx);
 
     std::optional<processing_status> get_processing_status(
@@ -14,6 +14,8 @@
 
 #include "members_statement_provider.h"
 
+#include "context/hlasm_context.h"
+#include "context/statement_arena.h"
 #include "library_info_transitional.h"
 
 namespace hlasm_plugin::parser_library::processing {
@@ -157,10 +159,21 @@ const context::statement_cache::cached_statement_t& members_statement_provider::
     {
         diagnostic_consumer_transform diag_consumer(
             [&reparsed_stmt](diagnostic_op diag) { reparsed_stmt.diags.push_back(std::move(diag)); });
-        auto [op, rem, lits] = m_parser.parse_operand_field(def_ops.value,
+
+        // a field rejected by the scan is dropped, just like during the macro definition
+        const bool usable = def_ops.scanned
+            || m_parser.scan_deferred_operand_field(def_ops.value,
+                semantics::range_provider(def_ops.field_range, semantics::adjusting_state::NONE),
+                def_ops.logical_column,
+                diag_consumer);
+        const lexing::u8string_with_newlines dropped_field;
+        const auto& field = usable ? def_ops.value : dropped_field;
+        const auto& field_range = usable ? def_ops.field_range : def_stmt->instruction.field_range;
+
+        auto [op, rem, lits] = m_parser.parse_operand_field(field,
             false,
-            semantics::range_provider(def_ops.field_range, semantics::adjusting_state::NONE),
-            def_ops.logical_column,
+            semantics::range_provider(field_range, semantics::adjusting_state::NONE),
+            usable ? def_ops.logical_column : 0,
             status,
             diag_consumer);
 
@@ -211,7 +224,8 @@ context::shared_stmt_ptr members_statement_provider::preprocess_deferred(const s
             m_diagnoser.add_diagnostic(diag);
     }
 
-    return std::make_shared<deferred_statement_adapter>(cache_item->stmt, status);
+    return context::make_arena_shared<deferred_statement_adapter>(
+        m_ctx.hlasm_ctx->current_statement_arena(), cache_item->stmt, status);
 }
 
 } // namespace hlasm_plugin::parser_library::processing
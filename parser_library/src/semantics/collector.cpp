@@ -16,6 +16,7 @@
 
 #include <stdexcept>
 
+#include "context/statement_arena.h"
 #include "expressions/data_definition.h"
 #include "operand_impls.h"
 #include "processing/statement.h"
@@ -135,6 +136,15 @@ void collector::set_operand_remark_field(lexing::u8string_with_newlines deferred
     add_operand_remark_hl_symbols();
 }
 
+void collector::set_operand_remark_field(
+    lexing::u8string_with_newlines deferred, range symbol_range, size_t logical_column)
+{
+    if (op_ || rem_ || def_)
+        throw std::runtime_error("field already assigned");
+    def_.emplace(symbol_range, logical_column, std::move(deferred), std::vector<vs_ptr>(), false);
+    rem_.emplace(std::vector<range>());
+}
+
 void collector::set_operand_remark_field(operand_list operands, remark_list remarks, range symbol_range)
 {
     if (op_ || rem_ || def_)
@@ -224,7 +234,9 @@ struct statement_si final : public processing::resolved_statement
     }
 };
 
-context::shared_stmt_ptr collector::extract_statement(processing::processing_status status, range& statement_range)
+context::shared_stmt_ptr collector::extract_statement(processing::processing_status status,
+    range& statement_range,
+    const std::shared_ptr<context::statement_arena>& arena)
 {
     if (!lbl_)
         lbl_.emplace(statement_range);
@@ -242,7 +254,8 @@ context::shared_stmt_ptr collector::extract_statement(processing::processing_sta
         // lit_ may contain literals due to &VAR(L'=A(0)) in macros
         if (!def_)
             def_.emplace(instr_->field_range, 0, lexing::u8string_with_newlines(), std::vector<vs_ptr>());
-        return std::make_shared<deferred_statement>(union_range(lbl_->field_range, def_->field_range),
+        return context::make_arena_shared<deferred_statement>(arena,
+            union_range(lbl_->field_range, def_->field_range),
             std::move(*lbl_),
             std::move(*instr_),
             std::move(*def_),
@@ -256,7 +269,8 @@ context::shared_stmt_ptr collector::extract_statement(processing::processing_sta
 
         assert(std::ranges::all_of(op_->value, [](const auto& p) { return !!p; }));
 
-        return std::make_shared<statement_si>(union_range(lbl_->field_range, op_->field_range),
+        return context::make_arena_shared<statement_si>(arena,
+            union_range(lbl_->field_range, op_->field_range),
             std::move(*lbl_),
             std::move(*instr_),
             std::move(*op_),
@@ -295,9 +309,14 @@ void collector::prepare_for_next_statement()
     statement_diagnostics_without_operands = 0;
 }
 
-std::shared_ptr<literal_si_data> collector::add_literal(std::string text, expressions::data_definition dd, range r)
+std::shared_ptr<literal_si_data> collector::add_literal(std::string text,
+    expressions::data_definition dd,
+    range r,
+    const std::shared_ptr<context::statement_arena>& arena)
 {
-    return lit_.emplace_back(std::make_shared<literal_si_data>(std::move(text), std::move(dd), r));
+    // the literal may outlive the statement (literal pool), so it keeps the arena of its expressions alive
+    return lit_.emplace_back(
+        context::make_arena_shared<literal_si_data>(arena, std::move(text), std::move(dd), r));
 }
 
 std::vector<literal_si> hlasm_plugin::parser_library::semantics::collector::take_literals() { return std::move(lit_); }
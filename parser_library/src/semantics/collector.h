@@ -22,6 +22,9 @@
 #include "protocol.h"
 #include "statement.h"
 
+namespace hlasm_plugin::parser_library::context {
+class statement_arena;
+} // namespace hlasm_plugin::parser_library::context
 namespace hlasm_plugin::parser_library::expressions {
 struct data_definition;
 } // namespace hlasm_plugin::parser_library::expressions
@@ -58,6 +61,7 @@ public:
         remark_list remarks,
         range symbol_range,
         size_t logical_column);
+    void set_operand_remark_field(lexing::u8string_with_newlines deferred, range symbol_range, size_t logical_column);
     void set_operand_remark_field(operand_list operands, remark_list remarks, range symbol_range);
 
     void add_hl_symbol(token_info symbol);
@@ -65,7 +69,9 @@ public:
 
     void append_operand_field(collector&& c);
 
-    context::shared_stmt_ptr extract_statement(processing::processing_status status, range& statement_range);
+    context::shared_stmt_ptr extract_statement(processing::processing_status status,
+        range& statement_range,
+        const std::shared_ptr<context::statement_arena>& arena = nullptr);
     std::span<const token_info> extract_hl_symbols();
     void set_hl_symbols(std::span<const token_info>);
     void prepare_for_next_statement();
@@ -73,7 +79,10 @@ public:
     diagnostic_op_consumer* diag_collector() { return &statement_diagnostics; }
     diagnostic_op_consumer_container& diag_container() { return statement_diagnostics; }
 
-    std::shared_ptr<literal_si_data> add_literal(std::string text, expressions::data_definition dd, range r);
+    std::shared_ptr<literal_si_data> add_literal(std::string text,
+        expressions::data_definition dd,
+        range r,
+        const std::shared_ptr<context::statement_arena>& arena = nullptr);
     std::vector<literal_si> take_literals();
     void set_literals(std::vector<literal_si> lit);
 
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "context/id_index.h"
+#include "context/statement_arena.h"
 #include "range.h"
 
 // the file contains structures representing operands in the operand field of statement
@@ -71,7 +72,7 @@ struct seq_sym
 class operand_visitor;
 
 // struct representing operand of instruction
-struct operand
+struct operand : context::arena_allocated
 {
 private:
     template<typename T>
@@ -147,12 +147,16 @@ struct operands_si
 // struct holding semantic information (si) about deferred operand field
 struct deferred_operands_si
 {
-    deferred_operands_si(
-        range field_range, size_t logical_column, lexing::u8string_with_newlines field, std::vector<vs_ptr> vars)
+    deferred_operands_si(range field_range,
+        size_t logical_column,
+        lexing::u8string_with_newlines field,
+        std::vector<vs_ptr> vars,
+        bool scanned = true)
         : field_range(std::move(field_range))
         , logical_column(logical_column)
         , value(std::move(field))
         , vars(std::move(vars))
+        , scanned(scanned)
     {}
 
     range field_range;
@@ -160,6 +164,8 @@ struct deferred_operands_si
 
     lexing::u8string_with_newlines value;
     std::vector<vs_ptr> vars;
+    // the field was only captured, it is scanned (without collecting vars) once the statement is reached
+    bool scanned;
 };
 
 // struct holding semantic information (si) about remark field
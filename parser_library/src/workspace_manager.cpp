@@ -24,6 +24,7 @@
 #include <deque>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <set>
@@ -58,6 +59,7 @@
 #include "workspace_manager_response.h"
 #include "workspaces/configuration_provider.h"
 #include "workspaces/file_manager_impl.h"
+#include "workspaces/io_worker_pool.h"
 #include "workspaces/workspace.h"
 #include "workspaces/workspace_configuration.h"
 
@@ -194,6 +196,8 @@ class workspace_manager_impl final : public workspace_manager,
         std::function<bool()> validator; // maybe empty
 
         work_item_type request_type;
+        // files changed by the item, the analysis in progress is cancelled only when it depends on one of them
+        std::shared_ptr<const std::vector<resource_location>> documents = nullptr;
 
         std::vector<std::pair<unsigned long long, std::function<void()>>> pending_requests;
 
@@ -309,6 +313,16 @@ class workspace_manager_impl final : public workspace_manager,
         return true;
     }
 
+    bool supersedes_active_task(const work_item& item)
+    {
+        if (!item.documents)
+            return false;
+        return std::ranges::any_of(*item.documents, [this](const auto& document) {
+            return ws_path_match(document)->config.is_configuration_file(document)
+                || m_ws.affects_parse_in_progress(document);
+        });
+    }
+
     bool run_active_task(const std::atomic<unsigned char>* yield_indicator)
     {
         const auto& [task, start] = m_active_task;
@@ -318,11 +332,34 @@ class workspace_manager_impl final : public workspace_manager,
 
         std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
 
-        const auto& [url, metadata, perf_metrics, errors, warnings, outputs_changed] = task.value();
+        const auto& [url, metadata, perf_metrics, errors, warnings, outputs_changed, cancelled] = task.value();
+
+        if (cancelled)
+        {
+            ++m_cancelled_analyses[url];
+            m_ws.requeue_file(url);
+            m_active_task = {};
+            return true;
+        }
+
+        m_file_timing[url].last_parse_duration = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+
+        size_t cancelled_analyses = 0;
+        if (auto it = m_cancelled_analyses.find(url); it != m_cancelled_analyses.end())
+        {
+            cancelled_analyses = it->second;
+            m_cancelled_analyses.erase(it);
+        }
 
-        if (perf_metrics)
+        if (perf_metrics || cancelled_analyses)
         {
-            parsing_metadata data { perf_metrics.value(), metadata, errors, warnings };
+            parsing_metadata data {
+                perf_metrics ? *perf_metrics : m_ws.last_metrics(url).value_or(performance_metrics()),
+                metadata,
+                errors,
+                warnings,
+                cancelled_analyses,
+            };
             for (auto consumer : m_parsing_metadata_consumers)
                 consumer->consume_parsing_metadata(url.get_uri(), duration.count(), data);
         }
@@ -337,13 +374,43 @@ class workspace_manager_impl final : public workspace_manager,
         return true;
     }
 
+    // the earliest time at which the analysis of the file should start
+    std::chrono::steady_clock::time_point reparse_time(const resource_location& url) const
+    {
+        if (!m_args.wakeup || m_args.max_reparse_delay <= std::chrono::milliseconds(0))
+            return std::chrono::steady_clock::time_point::min();
+
+        const auto it = m_file_timing.find(url);
+        if (it == m_file_timing.end())
+            return std::chrono::steady_clock::time_point::min();
+
+        const auto& [last_edit, last_parse_duration] = it->second;
+        if (last_edit == std::chrono::steady_clock::time_point::min())
+            return last_edit;
+
+        return last_edit
+            + std::min(std::max(m_args.min_reparse_delay, last_parse_duration), m_args.max_reparse_delay);
+    }
+
     std::pair<bool, bool> run_parse_loop(const std::atomic<unsigned char>* yield_indicator)
     {
+        // pending requests need the results immediately
+        const bool coalesce_edits = m_work_queue.empty();
+        std::optional<std::chrono::steady_clock::time_point> earliest_deferred;
+        const auto defer = [this, &earliest_deferred](const resource_location& url) {
+            const auto ready = reparse_time(url);
+            if (ready <= std::chrono::steady_clock::now())
+                return false;
+            if (!earliest_deferred || ready < *earliest_deferred)
+                earliest_deferred = ready;
+            return true;
+        };
+
         auto result = std::pair<bool, bool>(false, true);
         while (true)
         {
             resource_location file_to_parse;
-            auto task = m_ws.parse_file(&file_to_parse);
+            auto task = coalesce_edits ? m_ws.parse_file(&file_to_parse, defer) : m_ws.parse_file(&file_to_parse);
             if (!task.valid())
                 break;
 
@@ -357,6 +424,9 @@ class workspace_manager_impl final : public workspace_manager,
 
             result.first = true;
         }
+        if (earliest_deferred)
+            m_args.wakeup->wake_up_after(std::chrono::ceil<std::chrono::milliseconds>(
+                *earliest_deferred - std::chrono::steady_clock::now()));
         result.second = false;
         return result;
     }
@@ -371,6 +441,24 @@ class workspace_manager_impl final : public workspace_manager,
         return stuff_to_do;
     }
 
+    // uses the remaining idle time to prepare members the opened programs are likely to need
+    void run_preparse_loop(const std::atomic<unsigned char>* yield_indicator)
+    {
+        while (!yield_indicator || !yield_indicator->load(std::memory_order_relaxed))
+        {
+            if (!m_preparse_task.valid())
+                m_preparse_task = m_ws.preparse_dependencies();
+            if (!m_preparse_task.valid())
+                return;
+
+            m_preparse_task.resume(yield_indicator);
+            if (!m_preparse_task.done())
+                return;
+
+            m_preparse_task = {};
+        }
+    }
+
     static constexpr bool parsing_must_be_done(const work_item& item)
     {
         return item.request_type == work_item_type::query;
@@ -384,6 +472,9 @@ class workspace_manager_impl final : public workspace_manager,
         {
             if (!m_work_queue.empty())
             {
+                // requests always take precedence over the preparsing
+                m_preparse_task = {};
+
                 auto& item = m_work_queue.front();
                 if (!item.pending_requests.empty() && item.is_valid())
                     return;
@@ -402,7 +493,17 @@ class workspace_manager_impl final : public workspace_manager,
                     if (item.request_type == work_item_type::file_change)
                     {
                         parsing_done = false;
-                        m_active_task = {};
+                        // the analysis stops at the next statement boundary, before it can observe the change
+                        if (m_active_task.valid() && supersedes_active_task(item))
+                        {
+                            m_active_task.task.request_cancellation();
+                            if (!run_active_task(yield_indicator))
+                            {
+                                done = false;
+                                return;
+                            }
+                            finished_inflight_task = true;
+                        }
                     }
 
                     done = item.perform_action();
@@ -414,7 +515,11 @@ class workspace_manager_impl final : public workspace_manager,
                 }
             }
             else if (parsing_done)
+            {
+                store_index();
+                run_preparse_loop(yield_indicator);
                 return;
+            }
 
             if (m_active_task.valid())
             {
@@ -433,9 +538,50 @@ class workspace_manager_impl final : public workspace_manager,
         }
     }
 
+    // forgets programs that were deleted while the index was not in use
+    utils::task prune_index()
+    {
+        std::unordered_map<resource_location, std::vector<resource_location>> programs_by_directory;
+        for (const auto& program : m_ws.index().programs())
+        {
+            resource_location loc(program);
+            programs_by_directory[loc.parent()].emplace_back(std::move(loc));
+        }
+
+        for (const auto& [dir, programs] : programs_by_directory)
+        {
+            const auto [files, rc] = co_await m_file_manager.list_directory_files(dir);
+            if (rc != utils::path::list_directory_rc::done && rc != utils::path::list_directory_rc::not_exists)
+                continue;
+            for (const auto& program : programs)
+            {
+                if (std::ranges::find(files, program, utils::second_element) == files.end())
+                    m_ws.index().remove(program.get_uri());
+            }
+        }
+    }
+
+    void store_index(bool force = false)
+    {
+        if (!m_args.index_storage || !m_ws.index().modified())
+            return;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (const auto next = m_last_index_store + m_args.index_store_interval; !force && now < next)
+        {
+            if (m_args.wakeup)
+                m_args.wakeup->wake_up_after(std::chrono::ceil<std::chrono::milliseconds>(next - now));
+            return;
+        }
+
+        m_last_index_store = now;
+        m_args.index_storage->store(m_ws.index().serialize());
+    }
+
     void did_open_file(std::string_view document_uri, version_t version, std::string_view text) override
     {
         auto uri = normalized_uri(document_uri);
+        auto documents = changed_document(uri);
         auto open_result = std::make_shared<workspaces::file_content_state>();
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
@@ -444,6 +590,7 @@ class workspace_manager_impl final : public workspace_manager,
             },
             {},
             work_item_type::file_change,
+            documents,
         });
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
@@ -459,13 +606,20 @@ class workspace_manager_impl final : public workspace_manager,
             }),
             {},
             work_item_type::file_change,
+            std::move(documents),
         });
     }
 
+    static std::shared_ptr<const std::vector<resource_location>> changed_document(resource_location uri)
+    {
+        return std::make_shared<const std::vector<resource_location>>(1, std::move(uri));
+    }
+
     void did_change_file(
         std::string_view document_uri, version_t version, std::span<const document_change> changes) override
     {
         auto uri = normalized_uri(document_uri);
+        auto documents = changed_document(uri);
 
         struct captured_change
         {
@@ -493,9 +647,13 @@ class workspace_manager_impl final : public workspace_manager,
                     return cc.whole ? document_change(cc.text) : document_change(cc.change_range, cc.text);
                 });
                 m_file_manager.did_change_file(document_loc, version, list);
+                const auto now = std::chrono::steady_clock::now();
+                for (const auto& program : m_ws.affected_programs(document_loc))
+                    m_file_timing[program].last_edit = now;
             },
             {},
             work_item_type::file_change,
+            documents,
         });
 
         m_work_queue.emplace_back(work_item {
@@ -516,17 +674,23 @@ class workspace_manager_impl final : public workspace_manager,
                 }),
             {},
             work_item_type::file_change,
+            std::move(documents),
         });
     }
 
     void did_close_file(std::string_view document_uri) override
     {
         auto uri = normalized_uri(document_uri);
+        auto documents = changed_document(uri);
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
-            [this, document_loc = uri]() { m_file_manager.did_close_file(document_loc); },
+            [this, document_loc = uri]() {
+                m_file_manager.did_close_file(document_loc);
+                m_file_timing.erase(document_loc);
+            },
             {},
             work_item_type::file_change,
+            documents,
         });
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
@@ -536,6 +700,7 @@ class workspace_manager_impl final : public workspace_manager,
             }),
             {},
             work_item_type::file_change,
+            std::move(documents),
         });
     }
 
@@ -569,17 +734,42 @@ class workspace_manager_impl final : public workspace_manager,
 
     void did_change_watched_files(std::span<const fs_change> fs_changes) override
     {
+        // deleted programs (or directories) no longer define anything
+        for (const auto& change : fs_changes)
+        {
+            if (change.change_type == fs_change_type::deleted)
+                m_ws.index().remove(normalized_uri(change.uri).get_uri());
+        }
+
+        // notifications received before the previous batch started are merged into it,
+        // so that the libraries are refreshed and the dependencies are matched only once
+        if (m_watched_files_batch && !m_work_queue.empty() && m_work_queue.back().id == m_watched_files_batch_id)
+        {
+            for (const auto& change : fs_changes)
+                m_watched_files_batch->first.emplace_back(normalized_uri(change.uri));
+            return;
+        }
+
         auto paths_for_ws =
             std::make_shared<std::pair<std::vector<resource_location>, std::vector<workspaces::file_content_state>>>();
         for (const auto& change : fs_changes)
             paths_for_ws->first.emplace_back(normalized_uri(change.uri));
 
+        m_watched_files_batch = paths_for_ws;
+        auto documents = std::shared_ptr<const std::vector<resource_location>>(paths_for_ws, &paths_for_ws->first);
+
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
             std::function<utils::task()>([this, paths_for_ws]() -> utils::task {
+                if (m_watched_files_batch == paths_for_ws)
+                    m_watched_files_batch.reset();
+
                 std::vector<utils::task> pending_updates;
                 auto& [paths, changes] = *paths_for_ws;
 
+                std::ranges::sort(paths);
+                paths.erase(std::ranges::unique(paths).begin(), paths.end());
+
                 paths_for_ws->second.reserve(paths_for_ws->first.size());
                 for (const auto& path : paths)
                 {
@@ -598,6 +788,7 @@ class workspace_manager_impl final : public workspace_manager,
             }),
             {},
             work_item_type::file_change,
+            documents,
         });
 
         m_work_queue.emplace_back(work_item {
@@ -610,7 +801,9 @@ class workspace_manager_impl final : public workspace_manager,
             }),
             {},
             work_item_type::file_change,
+            std::move(documents),
         });
+        m_watched_files_batch_id = m_work_queue.back().id;
     }
 
     void register_diagnostics_consumer(diagnostics_consumer* consumer) override
@@ -675,8 +868,20 @@ class workspace_manager_impl final : public workspace_manager,
         });
     }
 
+    // the query is answered once the members of the program have the full lsp index
+    void request_full_lsp_details(std::string_view document_uri)
+    {
+        m_work_queue.emplace_back(work_item {
+            next_unique_id(),
+            [this, doc_loc = normalized_uri(document_uri)]() { m_ws.request_full_lsp_details(doc_loc); },
+            {},
+            work_item_type::file_change,
+        });
+    }
+
     void definition(std::string_view document_uri, position pos, workspace_manager_response<const location&> r) override
     {
+        request_full_lsp_details(document_uri);
         handle_request(document_uri, std::move(r), [pos](const auto& resp, auto& ws, const auto& doc_loc) {
             resp.provide(ws.definition(doc_loc, pos));
         });
@@ -692,6 +897,7 @@ class workspace_manager_impl final : public workspace_manager,
 
     void hover(std::string_view document_uri, position pos, workspace_manager_response<std::string_view> r) override
     {
+        request_full_lsp_details(document_uri);
         handle_request(document_uri, std::move(r), [pos](const auto& resp, auto& ws, const auto& doc_loc, auto tc) {
             resp.provide(ws.hover(doc_loc, pos, tc));
         });
@@ -738,14 +944,17 @@ class workspace_manager_impl final : public workspace_manager,
     {
         // TODO: should this action be also performed IN ORDER?
 
+        const bool lsp_index_changed = m_global_config.minimal_lsp_index != new_config.minimal_lsp_index;
         m_global_config = new_config;
 
         auto cfg = std::make_shared<const nlohmann::json>(
             full_cfg.empty() ? nlohmann::json() : nlohmann::json::parse(full_cfg));
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
-            std::function<utils::task()>([this, cfg = std::move(cfg)]() -> utils::task {
+            std::function<utils::task()>([this, cfg = std::move(cfg), lsp_index_changed]() -> utils::task {
                 m_implicit_workspace.settings = cfg;
+                if (lsp_index_changed)
+                    m_ws.mark_all_opened_files();
                 return handle_config_update(m_implicit_workspace);
             }),
             {},
@@ -766,7 +975,7 @@ class workspace_manager_impl final : public workspace_manager,
     }
 
     void semantic_tokens(
-        std::string_view document_uri, workspace_manager_response<std::span<const token_info>> r) override
+        std::string_view document_uri, workspace_manager_response<const semantic_tokens_info&> r) override
     {
         handle_request(document_uri, std::move(r), [](const auto& resp, auto& ws, const auto& doc_loc) {
             resp.provide(ws.semantic_tokens(doc_loc));
@@ -816,21 +1025,61 @@ class workspace_manager_impl final : public workspace_manager,
         r.provide(res);
     }
 
-    void collect_diags()
+    // files with unchanged generations are neither filtered nor copied again
+    bool update_file_diagnostics()
     {
-        std::unordered_set<std::string> suppress_files;
+        m_ws.produce_diagnostics(m_ws_diagnostics);
 
-        m_diagnostics.clear();
-        m_ws.produce_diagnostics(m_diagnostics);
-        std::erase_if(m_diagnostics, [this, &suppress_files](const auto& d) {
-            const auto& origin = d.related.empty() ? d.file_uri : d.related.back().location.uri;
-            return !allowed_scheme(origin) && (suppress_files.emplace(d.file_uri), true);
-        });
-        for (auto it = suppress_files.begin(); it != suppress_files.end();)
+        bool changed = false;
+        ++m_diagnostics_pass;
+        for (const auto& [file, generation, diags] : m_ws_diagnostics)
+        {
+            auto& cached = m_file_diagnostics[*file];
+            cached.pass = m_diagnostics_pass;
+            if (cached.generation == generation)
+                continue;
+
+            changed = true;
+            cached.generation = generation;
+            cached.diags.clear();
+            cached.suppressed.clear();
+            for (const auto& d : diags)
+            {
+                const auto& origin = d.related.empty() ? d.file_uri : d.related.back().location.uri;
+                if (allowed_scheme(origin))
+                    cached.diags.push_back(d);
+                else
+                    cached.suppressed.insert(d.file_uri);
+            }
+        }
+        changed |= std::erase_if(m_file_diagnostics, [pass = m_diagnostics_pass](const auto& e) {
+            return e.second.pass != pass;
+        }) > 0;
+
+        return changed;
+    }
+
+    void collect_diags()
+    {
+        if (update_file_diagnostics())
         {
-            auto node = suppress_files.extract(it++);
-            m_diagnostics.emplace_back(info_SUP(std::move(node.value())));
+            std::unordered_set<std::string> suppress_files;
+
+            m_diagnostics.clear();
+            for (const auto& [_, cached] : m_file_diagnostics)
+            {
+                m_diagnostics.insert(m_diagnostics.end(), cached.diags.begin(), cached.diags.end());
+                suppress_files.insert(cached.suppressed.begin(), cached.suppressed.end());
+            }
+            for (auto it = suppress_files.begin(); it != suppress_files.end();)
+            {
+                auto node = suppress_files.extract(it++);
+                m_diagnostics.emplace_back(info_SUP(std::move(node.value())));
+            }
+            m_file_diagnostics_size = m_diagnostics.size();
         }
+        else
+            m_diagnostics.erase(m_diagnostics.begin() + m_file_diagnostics_size, m_diagnostics.end());
 
         const auto usage = m_ws.report_used_configuration_files();
 
@@ -968,8 +1217,7 @@ class workspace_manager_impl final : public workspace_manager,
     list_directory_files(const utils::resource::resource_location& directory) const override
     {
         if (directory.is_local() && !utils::platform::is_web())
-            return utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
-                utils::path::list_directory_rc>>::from_value(utils::resource::list_directory_files(directory));
+            return m_io_pool.run([directory]() { return utils::resource::list_directory_files(directory); });
 
         if (!m_args.external_requests || !m_args.vscode_extensions || !allowed_scheme(directory))
             return utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
@@ -983,9 +1231,8 @@ class workspace_manager_impl final : public workspace_manager,
     list_directory_subdirs_and_symlinks(const utils::resource::resource_location& directory) const override
     {
         if (directory.is_local() && !utils::platform::is_web())
-            return utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
-                utils::path::list_directory_rc>>::
-                from_value(utils::resource::list_directory_subdirs_and_symlinks(directory));
+            return m_io_pool.run(
+                [directory]() { return utils::resource::list_directory_subdirs_and_symlinks(directory); });
 
         if (!m_args.external_requests || !m_args.vscode_extensions || !allowed_scheme(directory))
             return utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
@@ -994,6 +1241,10 @@ class workspace_manager_impl final : public workspace_manager,
         return list_directory_files_external(directory, true);
     }
 
+    // declared before everything that may await its results
+    mutable workspaces::io_worker_pool m_io_pool;
+    workspaces::io_worker_pool m_check_pool;
+
     std::deque<work_item> m_work_queue;
 
     struct
@@ -1003,6 +1254,25 @@ class workspace_manager_impl final : public workspace_manager,
 
         bool valid() const noexcept { return task.valid(); }
     } m_active_task;
+    // analyses abandoned since the last completed one
+    std::unordered_map<resource_location, size_t> m_cancelled_analyses;
+
+    // the last queued change notification batch that has not started yet
+    std::shared_ptr<std::pair<std::vector<resource_location>, std::vector<workspaces::file_content_state>>>
+        m_watched_files_batch;
+    unsigned long long m_watched_files_batch_id = 0;
+
+    struct file_timing
+    {
+        std::chrono::steady_clock::time_point last_edit = std::chrono::steady_clock::time_point::min();
+        std::chrono::milliseconds last_parse_duration = std::chrono::milliseconds(0);
+    };
+    // edits of opened programs and their dependencies, and the duration of their analyses
+    std::unordered_map<resource_location, file_timing> m_file_timing;
+
+    utils::task m_preparse_task;
+
+    std::chrono::steady_clock::time_point m_last_index_store = std::chrono::steady_clock::time_point::min();
 
     lib_config m_global_config;
 
@@ -1020,6 +1290,19 @@ class workspace_manager_impl final : public workspace_manager,
     message_consumer* m_message_consumer = nullptr;
     workspace_manager_requests* m_requests = nullptr;
     progress_notification_consumer* m_progress = nullptr;
+    struct cached_file_diagnostics
+    {
+        unsigned long long generation = 0;
+        unsigned long long pass = 0;
+        std::vector<diagnostic> diags;
+        // files with diagnostics that originate in a scheme that is not allowed
+        std::unordered_set<std::string> suppressed;
+    };
+    std::vector<workspaces::workspace::file_diagnostics> m_ws_diagnostics;
+    std::unordered_map<resource_location, cached_file_diagnostics> m_file_diagnostics;
+    unsigned long long m_diagnostics_pass = 0;
+    // the diagnostics of the files form the prefix of m_diagnostics, the configuration diagnostics follow
+    size_t m_file_diagnostics_size = 0;
     std::vector<diagnostic> m_diagnostics;
     std::vector<fade_message> m_fade_messages;
     unsigned long long m_unique_id_sequence = 0;
@@ -1027,6 +1310,7 @@ class workspace_manager_impl final : public workspace_manager,
     static std::string_view extract_scheme(std::string_view uri) { return uri.substr(0, uri.find(':') + 1); }
     void recompute_allow_list()
     {
+        auto previous = std::move(allowed_schemes);
         allowed_schemes.assign(std::begin(default_allowed_schemes), std::end(default_allowed_schemes));
         for (const auto& [uri, _] : m_workspaces)
         {
@@ -1038,6 +1322,13 @@ class workspace_manager_impl final : public workspace_manager,
         std::ranges::sort(allowed_schemes);
         auto [new_end, _] = std::ranges::unique(allowed_schemes);
         allowed_schemes.erase(new_end, allowed_schemes.end());
+
+        // the cached diagnostics were filtered using the previous list
+        if (allowed_schemes != previous)
+        {
+            for (auto& [_, cached] : m_file_diagnostics)
+                cached.generation = 0;
+        }
     }
 
     void add_workspace(std::string_view name, std::string_view uri) override
@@ -1160,11 +1451,14 @@ class workspace_manager_impl final : public workspace_manager,
         }
     }
 
-    void retrieve_output(
-        std::string_view document_uri, workspace_manager_response<std::span<const output_line>> r) override
+    void retrieve_output(std::string_view document_uri,
+        size_t first,
+        size_t count,
+        workspace_manager_response<const output_page&> r) override
     {
-        handle_request(document_uri, std::move(r), [](const auto& resp, auto& ws, const auto& doc_loc) {
-            resp.provide(ws.retrieve_output(doc_loc));
+        handle_request(document_uri, std::move(r), [first, count](const auto& resp, auto& ws, const auto& doc_loc) {
+            const auto [lines, generation] = ws.retrieve_output(doc_loc, first, count);
+            resp.provide(output_page { lines, generation });
         });
     }
 
@@ -1198,11 +1492,35 @@ class workspace_manager_impl final : public workspace_manager,
 
 public:
     explicit workspace_manager_impl(const workspace_manager_args& args)
-        : m_args(args)
+        : m_io_pool(utils::platform::is_web() ? 0 : args.io_concurrency,
+            [wakeup = args.wakeup]() {
+                if (wakeup)
+                    wakeup->wake_up();
+            })
+        , m_check_pool(utils::platform::is_web() ? 0 : args.check_concurrency)
+        , m_args(args)
         , m_file_manager(*this, args.text_conversion)
         , m_implicit_workspace(m_file_manager, m_global_config, this, this)
         , m_ws(m_file_manager, *this)
     {
+        if (m_args.share_member_caches)
+            m_ws.share_member_caches();
+        if (m_check_pool.concurrency())
+            m_ws.check_operands_on(&m_check_pool);
+
+        if (m_args.index_storage)
+        {
+            if (auto data = m_args.index_storage->load(); data.has_value() && m_ws.index().deserialize(*data))
+            {
+                m_work_queue.emplace_back(work_item {
+                    next_unique_id(),
+                    std::function<utils::task()>([this]() { return prune_index(); }),
+                    {},
+                    work_item_type::workspace_open,
+                });
+            }
+        }
+
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
             std::function<utils::task()>([this]() -> utils::task {
@@ -1218,6 +1536,8 @@ public:
 
     workspace_manager_impl(workspace_manager_impl&&) = delete;
     workspace_manager_impl& operator=(workspace_manager_impl&&) = delete;
+
+    ~workspace_manager_impl() { store_index(true); }
 };
 
 workspace_manager* create_workspace_manager_impl(const workspace_manager_args& args)
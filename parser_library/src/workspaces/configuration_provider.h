@@ -38,6 +38,7 @@ struct analyzer_configuration
     std::vector<preprocessor_options> pp_opts;
     utils::resource::resource_location alternative_config_url;
     std::int64_t dig_suppress_limit;
+    bool minimal_lsp_index;
     std::vector<std::pair<std::string, external_function>> external_functions;
 };
 
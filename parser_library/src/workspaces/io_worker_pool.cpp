@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "io_worker_pool.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+io_worker_pool::io_worker_pool(unsigned concurrency, std::function<void()> completed)
+    : m_completed(std::move(completed))
+{
+    m_threads.reserve(concurrency);
+    for (unsigned i = 0; i < concurrency; ++i)
+        m_threads.emplace_back(&io_worker_pool::worker, this);
+}
+
+io_worker_pool::~io_worker_pool()
+{
+    {
+        std::lock_guard g(m_mutex);
+        m_stop = true;
+        // the results of the queued operations are no longer awaited
+        m_jobs.clear();
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_threads)
+        t.join();
+}
+
+void io_worker_pool::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard g(m_mutex);
+        m_jobs.emplace_back(std::move(job));
+    }
+    m_cv.notify_one();
+}
+
+void io_worker_pool::worker()
+{
+    for (;;)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock g(m_mutex);
+            m_cv.wait(g, [this]() { return m_stop || !m_jobs.empty(); });
+            if (m_stop)
+                return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+        if (m_completed)
+            m_completed();
+    }
+}
+
+} // namespace hlasm_plugin::parser_library::workspaces
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_IO_WORKER_POOL_H
+#define HLASMPLUGIN_PARSERLIBRARY_IO_WORKER_POOL_H
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils/task.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// runs blocking I/O operations and other background work on a fixed number of threads
+// the results are awaited by busy waiting, the same way as responses to external requests
+class io_worker_pool
+{
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_jobs;
+    bool m_stop = false;
+    std::function<void()> m_completed;
+    std::vector<std::thread> m_threads;
+
+    void worker();
+
+public:
+    // no threads are started when the concurrency is zero, operations are then executed synchronously
+    // completed is invoked on the worker thread after each operation
+    explicit io_worker_pool(unsigned concurrency, std::function<void()> completed = {});
+    io_worker_pool(const io_worker_pool&) = delete;
+    io_worker_pool& operator=(const io_worker_pool&) = delete;
+    ~io_worker_pool();
+
+    unsigned concurrency() const noexcept { return (unsigned)m_threads.size(); }
+
+    // queues the job without tracking its completion, requires a non-zero concurrency
+    // jobs that have not started yet are dropped when the pool is destroyed
+    void submit(std::function<void()> job);
+
+    // the operation is queued immediately, not when the returned task is first resumed
+    template<std::invocable F>
+    [[nodiscard]] utils::value_task<std::invoke_result_t<F&>> run(F f)
+    {
+        using T = std::invoke_result_t<F&>;
+
+        if (m_threads.empty())
+            return utils::value_task<T>::from_value(f());
+
+        struct state_t
+        {
+            std::atomic<bool> done = false;
+            std::optional<T> result;
+            std::exception_ptr error;
+        };
+        auto state = std::make_shared<state_t>();
+
+        submit([state, f = std::move(f)]() mutable {
+            try
+            {
+                state->result.emplace(f());
+            }
+            catch (...)
+            {
+                state->error = std::current_exception();
+            }
+            state->done.store(true, std::memory_order_release);
+        });
+
+        return [](std::shared_ptr<state_t> s) -> utils::value_task<T> {
+            while (!s->done.load(std::memory_order_acquire))
+                co_await utils::task::suspend();
+            if (s->error)
+                std::rethrow_exception(s->error);
+            co_return std::move(*s->result);
+        }(std::move(state));
+    }
+};
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif
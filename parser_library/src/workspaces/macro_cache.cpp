@@ -14,6 +14,7 @@
 
 #include "macro_cache.h"
 
+#include <algorithm>
 #include <array>
 
 #include "analyzer.h"
@@ -129,6 +130,11 @@ version_stamp macro_cache::get_copy_member_versions(context::macro_definition& m
     return result;
 }
 
+bool macro_cache::contains(processing::processing_kind kind) const
+{
+    return std::ranges::any_of(cache_, [kind](const auto& e) { return e.first.kind == kind; });
+}
+
 void macro_cache::save_macro(const macro_cache_key& key, const analyzer& analyzer)
 {
     auto& cache_data = cache_[key];
@@ -125,6 +125,8 @@ public:
     std::optional<std::vector<std::shared_ptr<file>>> load_from_cache(
         const macro_cache_key& key, const analyzing_context& ctx) const;
     void save_macro(const macro_cache_key& key, const analyzer& analyzer);
+    // Checks whether the member was parsed as the specified kind in any context.
+    bool contains(processing::processing_kind kind) const;
 
 private:
     [[nodiscard]] const macro_cache_data* find_cached_data(const macro_cache_key& key) const;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "output_buffer.h"
+
+#include <algorithm>
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+namespace {
+// FNV-1a, the length of the text is included to separate the lines
+constexpr std::uint64_t fnv_offset = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+
+std::uint64_t hash_u32(std::uint64_t h, std::uint32_t v)
+{
+    for (int i = 0; i < 4; ++i, v >>= 8)
+        h = (h ^ (v & 0xff)) * fnv_prime;
+    return h;
+}
+
+std::uint64_t hash_text(std::uint64_t h, std::string_view text)
+{
+    for (const unsigned char c : text)
+        h = (h ^ c) * fnv_prime;
+    return h;
+}
+} // namespace
+
+void output_buffer::append(int level, std::string_view text)
+{
+    if (m_chunks.empty() || m_chunks.back().lines.size() == chunk_lines)
+    {
+        if (!m_chunks.empty())
+            m_chunks.back().text.shrink_to_fit();
+        auto& c = m_chunks.emplace_back();
+        c.lines.reserve(chunk_lines);
+        c.hash = fnv_offset;
+    }
+
+    auto& c = m_chunks.back();
+    c.text.append(text);
+    c.lines.push_back({ level, static_cast<std::uint32_t>(c.text.size()) });
+    c.hash = hash_u32(hash_u32(c.hash, static_cast<std::uint32_t>(level)), static_cast<std::uint32_t>(text.size()));
+    c.hash = hash_text(c.hash, text);
+
+    ++m_size;
+}
+
+std::vector<output_line> output_buffer::lines(size_t first, size_t count) const
+{
+    std::vector<output_line> result;
+    if (first >= m_size)
+        return result;
+
+    count = std::min(count, m_size - first);
+    result.reserve(count);
+
+    auto chunk_id = first / chunk_lines;
+    auto line_id = first % chunk_lines;
+    for (; result.size() < count; ++chunk_id, line_id = 0)
+    {
+        const auto& c = m_chunks[chunk_id];
+        for (; line_id < c.lines.size() && result.size() < count; ++line_id)
+        {
+            const auto start = line_id ? c.lines[line_id - 1].end : 0;
+            result.emplace_back(c.lines[line_id].level, c.text.substr(start, c.lines[line_id].end - start));
+        }
+    }
+
+    return result;
+}
+
+bool output_buffer::same_content(const output_buffer& other) const noexcept
+{
+    return m_size == other.m_size
+        && std::ranges::equal(m_chunks, other.m_chunks, {}, &chunk::hash, &chunk::hash);
+}
+
+} // namespace hlasm_plugin::parser_library::workspaces
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_OUTPUT_BUFFER_H
+#define HLASMPLUGIN_PARSERLIBRARY_OUTPUT_BUFFER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "protocol.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// MNOTE and PUNCH lines produced by an analysis
+// lines are packed into chunks of a fixed size, each summarized by a hash of its content,
+// so that outputs of two analyses are compared without touching the text
+class output_buffer
+{
+public:
+    static constexpr size_t chunk_lines = 1024;
+
+    void append(int level, std::string_view text);
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // at most count lines starting with the first one
+    std::vector<output_line> lines(size_t first, size_t count) const;
+
+    // hash based, a collision of all the chunk hashes is not considered
+    bool same_content(const output_buffer& other) const noexcept;
+
+private:
+    struct line_entry
+    {
+        int level;
+        std::uint32_t end;
+    };
+
+    struct chunk
+    {
+        std::string text;
+        std::vector<line_entry> lines;
+        std::uint64_t hash;
+    };
+
+    std::vector<chunk> m_chunks;
+    size_t m_size = 0;
+};
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif
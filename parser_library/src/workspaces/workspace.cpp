@@ -15,6 +15,7 @@
 #include "workspace.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <map>
 #include <memory>
@@ -32,7 +33,9 @@
 #include "lsp/folding.h"
 #include "lsp/item_convertors.h"
 #include "lsp/lsp_context.h"
+#include "lsp_detail_provider.h"
 #include "macro_cache.h"
+#include "output_buffer.h"
 #include "output_handler.h"
 #include "parse_lib_provider.h"
 #include "processing/statement_analyzers/hit_count_analyzer.h"
@@ -40,9 +43,11 @@
 #include "semantics/highlighting_info.h"
 #include "utils/bk_tree.h"
 #include "utils/factory.h"
+#include "utils/general_hashers.h"
 #include "utils/levenshtein_distance.h"
 #include "utils/path_conversions.h"
 #include "utils/projectors.h"
+#include "utils/scope_exit.h"
 #include "utils/transform_inserter.h"
 
 using hlasm_plugin::utils::resource::resource_location;
@@ -51,11 +56,14 @@ namespace hlasm_plugin::parser_library::workspaces {
 
 struct workspace::dependency_cache
 {
-    dependency_cache(version_t version, const file_manager& fm, std::shared_ptr<file> file)
+    dependency_cache(version_t version, const file_manager& fm, std::shared_ptr<file> file, bool full_lsp_details)
         : version(version)
+        , full_lsp_details(full_lsp_details)
         , cache(fm, std::move(file))
     {}
     version_t version;
+    // files not opened in the editor only collect a minimal lsp index unless a query asked for more
+    bool full_lsp_details;
     macro_cache cache;
 };
 
@@ -68,10 +76,24 @@ struct workspace::processor_file_compoments
         m_dependencies;
     std::map<std::string, resource_location, std::less<>> m_member_map;
 
+    struct member_usage
+    {
+        std::string name;
+        processing::processing_kind kind;
+        size_t analyses = 0;
+        size_t hits = 0;
+    };
+    // members used by the previous analyses of the program
+    std::map<resource_location, member_usage, std::less<>> m_member_history;
+    // members from the history that the last analysis did not use, the most used one is the last
+    std::vector<resource_location> m_preparse_candidates;
+
     resource_location m_alternative_config = resource_location();
 
     bool m_opened = false;
     bool m_collect_perf_metrics = false;
+    // a query needed the full lsp index of the members
+    bool m_full_lsp_details = false;
 
     bool m_last_opencode_analyzer_with_lsp = false;
     bool m_last_macro_analyzer_with_lsp = false;
@@ -86,9 +108,19 @@ struct workspace::processor_file_compoments
     [[nodiscard]] utils::task update_source_if_needed(file_manager& fm);
 };
 
+namespace {
+// unique across all workspaces
+std::atomic<unsigned long long> results_generations = 0;
+unsigned long long next_results_generation()
+{
+    return results_generations.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+} // namespace
+
 struct parsing_results
 {
     semantics::lines_info hl_info;
+    unsigned long long hl_info_generation = next_results_generation();
     std::shared_ptr<lsp::lsp_context> lsp_context;
     std::shared_ptr<const std::vector<fade_message>> fade_messages;
     performance_metrics metrics;
@@ -98,27 +130,30 @@ struct parsing_results
 
     std::vector<diagnostic> opencode_diagnostics;
     std::vector<diagnostic> macro_diagnostics;
+    // change whenever the respective diagnostics do
+    unsigned long long opencode_diagnostics_generation = next_results_generation();
+    unsigned long long macro_diagnostics_generation = next_results_generation();
 
-    std::vector<output_line> outputs;
+    output_buffer outputs;
+    unsigned long long outputs_generation = next_results_generation();
 };
 
 [[nodiscard]] utils::value_task<parsing_results> parse_one_file(std::shared_ptr<context::id_storage> ids,
     std::shared_ptr<file> file,
     parse_lib_provider& lib_provider,
+    const lsp_detail_provider* lsp_details,
     asm_option asm_opts,
     std::vector<preprocessor_options> pp,
     external_functions_list ef,
-    virtual_file_monitor* vfm)
+    virtual_file_monitor* vfm,
+    io_worker_pool* check_pool)
 {
     struct output_t final : output_handler
     {
-        std::vector<output_line> lines;
+        output_buffer lines;
 
-        void mnote(unsigned char level, std::string_view text) override
-        {
-            lines.emplace_back(level, std::string(text));
-        }
-        void punch(std::string_view text) override { lines.emplace_back(-1, std::string(text)); }
+        void mnote(unsigned char level, std::string_view text) override { lines.append(level, text); }
+        void punch(std::string_view text) override { lines.append(-1, text); }
     } outputs;
 
     auto fms = std::make_shared<std::vector<fade_message>>();
@@ -135,6 +170,8 @@ struct parsing_results
             vfm,
             fms,
             &outputs,
+            lsp_details,
+            operand_check_pool { check_pool },
         });
 
     processing::hit_count_analyzer hc_analyzer(a.hlasm_ctx());
@@ -170,14 +207,40 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
     std::map<std::string, resource_location, std::less<>> next_member_map;
     std::unordered_map<resource_location, std::shared_ptr<file>> current_file_map;
 
+    bool minimal_lsp_index;
+
+    // library members not opened in the editor only get a minimal lsp index
+    bool wants_full_lsp_details(const file& member) const
+    {
+        return !minimal_lsp_index || pfc.m_full_lsp_details || member.get_lsp_editing();
+    }
+
+    struct member_details final : lsp_detail_provider
+    {
+        const workspace_parse_lib_provider& libs;
+
+        explicit member_details(const workspace_parse_lib_provider& libs)
+            : libs(libs)
+        {}
+
+        bool full_lsp_details(const resource_location& file_loc) const override
+        {
+            const auto it = libs.current_file_map.find(file_loc);
+            return it == libs.current_file_map.end() || libs.wants_full_lsp_details(*it->second);
+        }
+    } lsp_details;
+
     workspace_parse_lib_provider(file_manager& fm,
         workspace& ws,
         std::vector<std::shared_ptr<library>> libraries,
-        workspace::processor_file_compoments& pfc)
+        workspace::processor_file_compoments& pfc,
+        bool minimal_lsp_index)
         : fm(fm)
         , ws(ws)
         , libraries(std::move(libraries))
         , pfc(pfc)
+        , minimal_lsp_index(minimal_lsp_index)
+        , lsp_details(*this)
     {}
 
     void append_files_to_close(std::set<resource_location>& files_to_close)
@@ -223,11 +286,22 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             next_dependencies
                 .try_emplace(url, utils::factory([&url, &file, this]() {
                     auto version = file->get_version();
-                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end()
-                        && std::get<std::shared_ptr<workspace::dependency_cache>>(it->second)->version == version)
-                        return std::get<std::shared_ptr<workspace::dependency_cache>>(it->second);
-
-                    return std::make_shared<workspace::dependency_cache>(version, fm, file);
+                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end())
+                    {
+                        // members with a minimal lsp index are reparsed once the full one is needed
+                        const auto& dep = std::get<std::shared_ptr<workspace::dependency_cache>>(it->second);
+                        if (dep->version == version && (dep->full_lsp_details || !wants_full_lsp_details(*file)))
+                            return dep;
+                    }
+                    if (auto it = ws.m_preparsed.find(ws.preparsed_key(url, pfc)); it != ws.m_preparsed.end())
+                    {
+                        const auto& dep = it->second;
+                        if (dep->version == version && (dep->full_lsp_details || !wants_full_lsp_details(*file)))
+                            return dep;
+                    }
+
+                    return std::make_shared<workspace::dependency_cache>(
+                        version, fm, file, wants_full_lsp_details(*file));
                 }))
                 .first->second)
             ->cache;
@@ -271,6 +345,7 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
                 std::move(ctx),
                 analyzer_options::dependency(std::move(library), kind),
                 collect_hl ? collect_highlighting_info::yes : collect_highlighting_info::no,
+                &lsp_details,
             });
 
         processing::hit_count_analyzer hc_analyzer(a.hlasm_ctx());
@@ -281,11 +356,15 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
 
         macro_pfc.m_last_results->macro_diagnostics.assign(
             std::make_move_iterator(d.begin()), std::make_move_iterator(d.end()));
+        macro_pfc.m_last_results->macro_diagnostics_generation = next_results_generation();
 
         mc.save_macro(cache_key, a);
         macro_pfc.m_last_macro_analyzer_with_lsp = collect_hl;
         if (collect_hl)
+        {
             macro_pfc.m_last_results->hl_info = a.take_semantic_tokens();
+            macro_pfc.m_last_results->hl_info_generation = next_results_generation();
+        }
 
         macro_pfc.m_last_results->hc_macro_map = hc_analyzer.take_hit_count_map();
 
@@ -322,6 +401,25 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
 
         return utils::task::wait_all(std::move(pending_prefetches));
     }
+
+    // the analysis requests members one at a time, so remote members used by the previous analysis are requested
+    // together upfront
+    [[nodiscard]] utils::task prefetch_members()
+    {
+        std::vector<utils::task> pending_reads;
+        for (const auto& [url, dep] : pfc.m_dependencies)
+        {
+            if (url.is_local() || !std::holds_alternative<std::shared_ptr<workspace::dependency_cache>>(dep))
+                continue;
+            pending_reads.emplace_back(ws.file_manager_.add_file(url).then(
+                [this, url](std::shared_ptr<file> f) { current_file_map.try_emplace(url, std::move(f)); }));
+        }
+
+        if (pending_reads.empty())
+            return {};
+
+        return utils::task::wait_all(std::move(pending_reads));
+    }
 };
 
 workspace::workspace(file_manager& file_manager, configuration_provider& configuration)
@@ -332,6 +430,12 @@ workspace::workspace(file_manager& file_manager, configuration_provider& configu
 
 workspace::~workspace() = default;
 
+void workspace::share_member_caches()
+{
+    if (!m_shared_ids)
+        m_shared_ids = context::hlasm_context::make_default_id_storage();
+}
+
 std::unordered_map<utils::resource::resource_location, std::vector<utils::resource::resource_location>>
 workspace::report_used_configuration_files() const
 {
@@ -348,16 +452,23 @@ workspace::report_used_configuration_files() const
 
 void workspace::produce_diagnostics(std::vector<diagnostic>& target) const
 {
+    std::vector<file_diagnostics> files;
+    produce_diagnostics(files);
+    for (const auto& f : files)
+        target.insert(target.end(), f.diagnostics.begin(), f.diagnostics.end());
+}
+
+void workspace::produce_diagnostics(std::vector<file_diagnostics>& target) const
+{
+    target.clear();
+    target.reserve(m_processor_files.size());
     for (const auto& [url, pfc] : m_processor_files)
     {
+        const auto& r = *pfc.m_last_results;
         if (is_dependency(url))
-            target.insert(target.end(),
-                pfc.m_last_results->macro_diagnostics.begin(),
-                pfc.m_last_results->macro_diagnostics.end());
+            target.push_back({ &url, r.macro_diagnostics_generation, r.macro_diagnostics });
         else
-            target.insert(target.end(),
-                pfc.m_last_results->opencode_diagnostics.begin(),
-                pfc.m_last_results->opencode_diagnostics.end());
+            target.push_back({ &url, r.opencode_diagnostics_generation, r.opencode_diagnostics });
     }
 }
 
@@ -554,11 +665,8 @@ std::vector<const workspace::processor_file_compoments*> workspace::find_related
     if (auto f = find_processor_file_impl(document_loc); f)
         opencodes.push_back(f);
 
-    for (const auto& [_, component] : m_processor_files)
-    {
-        if (component.m_dependencies.contains(document_loc))
-            opencodes.push_back(&component);
-    }
+    if (auto it = m_dependants.find(document_loc); it != m_dependants.end())
+        opencodes.insert(opencodes.end(), it->second.begin(), it->second.end());
 
     return opencodes;
 }
@@ -579,6 +687,8 @@ void workspace::delete_diags(processor_file_compoments& pfc)
     }
 
     pfc.m_last_results->opencode_diagnostics.push_back(info_SUP(std::string(pfc.m_file->get_location().get_uri())));
+    pfc.m_last_results->opencode_diagnostics_generation = next_results_generation();
+    pfc.m_last_results->macro_diagnostics_generation = next_results_generation();
 }
 
 void workspace::show_message(std::string_view message)
@@ -587,12 +697,15 @@ void workspace::show_message(std::string_view message)
         message_consumer_->show_message(message, message_type::MT_INFO);
 }
 
-utils::value_task<parse_file_result> workspace::parse_file(resource_location* selected)
+utils::value_task<parse_file_result> workspace::parse_file(
+    resource_location* selected, const std::function<bool(const resource_location&)>& defer)
 {
-    if (m_parsing_pending.empty())
+    const auto next = defer ? std::ranges::find_if_not(m_parsing_pending, defer) : m_parsing_pending.begin();
+    if (next == m_parsing_pending.end())
         return {};
 
-    const auto& file_to_parse = *m_parsing_pending.begin();
+    // changes that arrive during the analysis schedule the file again
+    const auto file_to_parse = std::move(m_parsing_pending.extract(next).value());
     if (selected)
         *selected = file_to_parse;
     processor_file_compoments& comp = m_processor_files.at(file_to_parse);
@@ -600,39 +713,69 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
     assert(comp.m_opened);
 
     if (!comp.m_last_opencode_id_storage)
-        comp.m_last_opencode_id_storage = context::hlasm_context::make_default_id_storage();
+        comp.m_last_opencode_id_storage =
+            m_shared_ids ? m_shared_ids : context::hlasm_context::make_default_id_storage();
 
     return [](processor_file_compoments& comp, workspace& self) -> utils::value_task<parse_file_result> {
         const auto& url = comp.m_file->get_location();
 
+        // also cleared when the analysis is abandoned
+        self.m_parse_in_progress = parse_in_progress { &comp, nullptr };
+        utils::scope_exit clear_parse_in_progress([&self]() noexcept { self.m_parse_in_progress.reset(); });
+
         auto [config, proc_grp_id] = co_await self.m_configuration.get_analyzer_configuration(url);
 
         comp.m_alternative_config = std::move(config.alternative_config_url);
-        workspace_parse_lib_provider ws_lib(self.file_manager_, self, std::move(config.libraries), comp);
+        // members prepared for the group are looked up during the analysis
+        comp.m_group_id = proc_grp_id;
+        workspace_parse_lib_provider ws_lib(
+            self.file_manager_, self, std::move(config.libraries), comp, config.minimal_lsp_index);
+        self.m_parse_in_progress->libs = &ws_lib;
 
         if (auto prefetch = ws_lib.prefetch_libraries(); prefetch.valid())
             co_await std::move(prefetch);
+        if (auto prefetch = ws_lib.prefetch_members(); prefetch.valid())
+            co_await std::move(prefetch);
 
         bool collect_perf_metrics = comp.m_collect_perf_metrics;
 
         auto results = co_await parse_one_file(comp.m_last_opencode_id_storage,
             comp.m_file,
             ws_lib,
+            &ws_lib.lsp_details,
             std::move(config.opts),
             std::move(config.pp_opts),
             std::move(config.external_functions),
-            &self.fm_vfm_);
+            &self.fm_vfm_,
+            self.m_check_pool);
+
+        if (co_await utils::task::cancelled())
+        {
+            self.m_parse_in_progress.reset();
+
+            std::set<resource_location> files_to_close;
+            ws_lib.append_files_to_close(files_to_close);
+            self.filter_and_close_dependencies(std::move(files_to_close));
+
+            co_return parse_file_result { .filename = url, .cancelled = true };
+        }
+
         results.hc_macro_map = std::move(comp.m_last_results->hc_macro_map); // save macro stuff
         results.macro_diagnostics = std::move(comp.m_last_results->macro_diagnostics);
-        const bool outputs_changed = comp.m_last_results->outputs != results.outputs;
+        results.macro_diagnostics_generation = comp.m_last_results->macro_diagnostics_generation;
+        const bool outputs_changed = !comp.m_last_results->outputs.same_content(results.outputs);
+        if (!outputs_changed)
+            results.outputs_generation = comp.m_last_results->outputs_generation;
         *comp.m_last_results = std::move(results);
 
+        self.m_parse_in_progress.reset();
+
         std::set<resource_location> files_to_close;
         ws_lib.append_files_to_close(files_to_close);
 
         auto parse_results = self.parse_successful(comp, std::move(ws_lib), !!proc_grp_id, config.dig_suppress_limit);
 
-        comp.m_group_id = proc_grp_id;
+        self.update_index(comp);
 
         self.filter_and_close_dependencies(std::move(files_to_close));
 
@@ -655,6 +798,158 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
     }(comp, *this);
 }
 
+bool workspace::affects_parse_in_progress(const resource_location& file_location) const
+{
+    if (!m_parse_in_progress)
+        return false;
+
+    const auto& [comp, libs] = *m_parse_in_progress;
+
+    return comp->m_file->get_location() == file_location || comp->m_alternative_config == file_location
+        || comp->m_dependencies.contains(file_location) || (libs && libs->next_dependencies.contains(file_location));
+}
+
+void workspace::requeue_file(const resource_location& file_location)
+{
+    if (auto it = m_processor_files.find(file_location); it != m_processor_files.end() && it->second.m_opened)
+        m_parsing_pending.emplace(file_location);
+}
+
+std::vector<utils::resource::resource_location> workspace::affected_programs(
+    const resource_location& file_location) const
+{
+    std::vector<resource_location> result;
+    if (auto it = m_processor_files.find(file_location); it != m_processor_files.end() && it->second.m_opened)
+        result.push_back(file_location);
+    if (auto it = m_dependants.find(file_location); it != m_dependants.end())
+    {
+        for (const auto* component : it->second)
+            if (component->m_opened)
+                result.push_back(component->m_file->get_location());
+    }
+    return result;
+}
+
+workspace::preparse_key workspace::preparsed_key(const resource_location& member, const processor_file_compoments& comp)
+{
+    return { member, comp.m_group_id, comp.m_last_opencode_id_storage.get() };
+}
+
+size_t workspace::preparse_key_hash::operator()(const preparse_key& key) const noexcept
+{
+    using utils::hashers::hash_combine;
+    const auto h = hash_combine(std::hash<resource_location>()(key.member), key.group ? key.group.value() + 1 : 0);
+    return hash_combine(h, std::hash<const void*>()(key.ids));
+}
+
+void workspace::update_member_history(processor_file_compoments& comp)
+{
+    for (const auto& [name, url] : comp.m_member_map)
+    {
+        const auto dep = comp.m_dependencies.find(url);
+        if (dep == comp.m_dependencies.end())
+            continue;
+        const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep->second);
+        if (!cache)
+            continue;
+
+        processing::processing_kind kind;
+        if ((*cache)->cache.contains(processing::processing_kind::MACRO))
+            kind = processing::processing_kind::MACRO;
+        else if ((*cache)->cache.contains(processing::processing_kind::COPY))
+            kind = processing::processing_kind::COPY;
+        else
+            continue;
+
+        auto& usage = comp.m_member_history[url];
+        usage.name = name;
+        usage.kind = kind;
+        ++usage.analyses;
+        if (const auto hc = comp.m_last_results->hc_opencode_map.find(url);
+            hc != comp.m_last_results->hc_opencode_map.end())
+        {
+            for (const auto& line : hc->second.details)
+                usage.hits += line.count;
+        }
+    }
+
+    comp.m_preparse_candidates.clear();
+    for (const auto& [url, _] : comp.m_member_history)
+        if (!comp.m_dependencies.contains(url))
+            comp.m_preparse_candidates.emplace_back(url);
+
+    std::ranges::sort(comp.m_preparse_candidates, {}, [&history = comp.m_member_history](const auto& url) {
+        const auto& usage = history.find(url)->second;
+        return std::pair(usage.analyses, usage.hits);
+    });
+    if (comp.m_preparse_candidates.size() > max_preparse_candidates)
+        comp.m_preparse_candidates.erase(comp.m_preparse_candidates.begin(),
+            comp.m_preparse_candidates.end() - max_preparse_candidates);
+}
+
+utils::task workspace::preparse_dependencies()
+{
+    if (!m_parsing_pending.empty())
+        return {};
+
+    for (auto& [_, comp] : m_processor_files)
+    {
+        if (!comp.m_opened || !comp.m_last_opencode_id_storage)
+            continue;
+
+        while (!comp.m_preparse_candidates.empty())
+        {
+            auto url = std::move(comp.m_preparse_candidates.back());
+            comp.m_preparse_candidates.pop_back();
+
+            const auto usage = comp.m_member_history.find(url);
+            if (usage == comp.m_member_history.end() || comp.m_dependencies.contains(url)
+                || m_preparsed.contains(preparsed_key(url, comp)))
+                continue;
+
+            return preparse_member(comp, usage->second.name, std::move(url), usage->second.kind);
+        }
+    }
+
+    return {};
+}
+
+utils::task workspace::preparse_member(
+    processor_file_compoments& comp, std::string name, resource_location url, processing::processing_kind kind)
+{
+    const auto opencode_url = comp.m_file->get_location();
+
+    auto [config, _] = co_await m_configuration.get_analyzer_configuration(opencode_url);
+
+    workspace_parse_lib_provider ws_lib(
+        file_manager_, *this, std::move(config.libraries), comp, config.minimal_lsp_index);
+
+    if (auto prefetch = ws_lib.prefetch_libraries(); prefetch.valid())
+        co_await std::move(prefetch);
+
+    // the member must still resolve to the same file for this program
+    if (resource_location resolved; !ws_lib.has_library(name, &resolved) || resolved != url)
+    {
+        comp.m_member_history.erase(url);
+        co_return;
+    }
+
+    analyzer a("",
+        analyzer_options {
+            opencode_url,
+            &ws_lib,
+            std::move(config.opts),
+            comp.m_last_opencode_id_storage,
+            &ws_lib.lsp_details,
+        });
+
+    co_await ws_lib.parse_library(std::move(name), a.context(), kind);
+
+    for (auto& [loc, dep] : ws_lib.next_dependencies)
+        if (auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep))
+            m_preparsed.insert_or_assign(preparsed_key(loc, comp), std::move(*cache));
+}
+
 namespace {
 bool trigger_reparse(const resource_location& file_location) { return !file_location.get_uri().starts_with("hlasm:"); }
 } // namespace
@@ -678,13 +973,13 @@ utils::task workspace::mark_file_for_parsing(
 
     if (file_content_status == file_content_state::changed_content && trigger_reparse(file_location))
     {
-        for (auto& [_, component] : m_processor_files)
+        if (auto it = m_dependants.find(file_location); it != m_dependants.end())
         {
-            if (!component.m_opened)
-                continue;
-            if (component.m_dependencies.contains(file_location))
-                m_parsing_pending.emplace(component.m_file->get_location());
+            for (const auto* component : it->second)
+                if (component->m_opened)
+                    m_parsing_pending.emplace(component->m_file->get_location());
         }
+        std::erase_if(m_preparsed, [&file_location](const auto& e) { return e.first.member == file_location; });
     }
 
     if (auto it = m_processor_files.find(file_location); it != m_processor_files.end() && it->second.m_opened)
@@ -713,7 +1008,6 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
     workspace_file_info ws_file_info;
 
     comp.m_collect_perf_metrics = false; // only on open/first parsing
-    m_parsing_pending.erase(comp.m_file->get_location());
 
     ws_file_info.processor_group_found = has_processor_group;
     if (!has_processor_group && std::cmp_greater(comp.m_last_results->opencode_diagnostics.size(), diag_suppress_limit))
@@ -728,9 +1022,16 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
 
     ws_file_info.files_processed = libs.next_dependencies.size() + 1; // TODO: identify error states?
 
+    remove_dependant(comp);
     comp.m_dependencies = std::move(libs.next_dependencies);
+    add_dependant(comp);
     comp.m_member_map = std::move(libs.next_member_map);
 
+    update_member_history(comp);
+    std::erase_if(m_preparsed, [&comp](const auto& e) {
+        return e.first.ids == comp.m_last_opencode_id_storage.get() && comp.m_dependencies.contains(e.first.member);
+    });
+
     return ws_file_info;
 }
 
@@ -742,6 +1043,36 @@ utils::task workspace::did_open_file(resource_location file_location, file_conte
     m_parsing_pending.emplace(file_location);
     if (auto t = mark_file_for_parsing(file_location, file_content_status); t.valid())
         co_await std::move(t);
+
+    // upgrade the minimal lsp index of the dependency
+    if (auto dependants = m_dependants.find(file_location); dependants != m_dependants.end())
+    {
+        for (const auto* component : dependants->second)
+        {
+            if (!component->m_opened)
+                continue;
+            const auto& dep = component->m_dependencies.at(file_location);
+            if (const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep);
+                cache && !(*cache)->full_lsp_details)
+                m_parsing_pending.emplace(component->m_file->get_location());
+        }
+    }
+}
+
+void workspace::request_full_lsp_details(const resource_location& file_location)
+{
+    auto it = m_processor_files.find(file_location);
+    if (it == m_processor_files.end() || !it->second.m_opened || it->second.m_full_lsp_details)
+        return;
+
+    auto& comp = it->second;
+    comp.m_full_lsp_details = true;
+
+    if (std::ranges::any_of(comp.m_dependencies, [](const auto& dep) {
+            const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep.second);
+            return cache && !(*cache)->full_lsp_details;
+        }))
+        m_parsing_pending.emplace(file_location);
 }
 
 utils::task workspace::did_close_file(resource_location file_location)
@@ -751,15 +1082,19 @@ utils::task workspace::did_close_file(resource_location file_location)
         co_return; // this indicates some kind of double close or configuration file close
 
     fcomp->second.m_opened = false;
+    fcomp->second.m_full_lsp_details = false;
     m_parsing_pending.erase(file_location);
 
     bool found_dependency = false;
     // first check whether the file is a dependency
     std::vector<utils::task> pending_updates;
-    for (std::shared_ptr<file> file; const auto& [_, component] : m_processor_files)
+    std::vector<const processor_file_compoments*> dependants;
+    if (auto it = m_dependants.find(file_location); it != m_dependants.end())
+        dependants = it->second;
+    for (std::shared_ptr<file> file; const auto* component : dependants)
     {
-        auto it = component.m_dependencies.find(file_location);
-        if (it == component.m_dependencies.end())
+        auto it = component->m_dependencies.find(file_location);
+        if (it == component->m_dependencies.end())
             continue;
         if (!std::holds_alternative<std::shared_ptr<dependency_cache>>(it->second))
             continue;
@@ -783,12 +1118,25 @@ utils::task workspace::did_close_file(resource_location file_location)
     // find if the file is a dependant
 
     std::set<resource_location> files_to_close;
-    for (const auto& [dep, _] : fcomp->second.m_dependencies)
+    for (const auto& [dep, cache] : fcomp->second.m_dependencies)
+    {
         files_to_close.insert(dep);
+        // handed over to the programs opened later
+        if (const auto* c = std::get_if<std::shared_ptr<dependency_cache>>(&cache); c && m_shared_ids)
+            m_preparsed.insert_or_assign(preparsed_key(dep, fcomp->second), *c);
+    }
+    if (!m_shared_ids)
+    {
+        const auto* ids = fcomp->second.m_last_opencode_id_storage.get();
+        std::erase_if(m_preparsed, [ids, &files_to_close](const auto& e) {
+            return e.first.ids == ids && (files_to_close.insert(e.first.member), true);
+        });
+    }
     // filter the dependencies that should not be closed
     filter_and_close_dependencies(std::move(files_to_close), &fcomp->second);
 
     // close the file itself
+    remove_dependant(fcomp->second);
     m_processor_files.erase(fcomp);
 }
 
@@ -798,29 +1146,55 @@ utils::task workspace::did_change_watched_files(std::vector<resource_location> f
 {
     assert(file_locations.size() == file_change_status.size());
 
+    // each affected program is scheduled once for the whole batch
+    std::unordered_set<resource_location> changed_dependencies;
     std::vector<utils::task> pending_updates;
     for (auto cit = file_change_status.begin(); const auto& file_location : file_locations)
     {
         auto change_status = *cit++;
         if (changed_groups)
             change_status = file_content_state::changed_content;
-        auto t = mark_file_for_parsing(file_location, change_status);
-        if (!t.valid() || t.done())
+        if (change_status == file_content_state::identical)
+            continue;
+
+        if (change_status == file_content_state::changed_content && trigger_reparse(file_location))
+            changed_dependencies.insert(file_location);
+
+        auto it = m_processor_files.find(file_location);
+        if (it == m_processor_files.end() || !it->second.m_opened)
             continue;
 
-        pending_updates.emplace_back(std::move(t));
+        m_parsing_pending.emplace(it->second.m_file->get_location());
+        if (auto t = it->second.update_source_if_needed(file_manager_); t.valid() && !t.done())
+            pending_updates.emplace_back(std::move(t));
     }
-    if (changed_groups)
+
+    for (const auto& dep : changed_dependencies)
     {
-        for (const auto& [_, comp] : m_processor_files)
-        {
-            if (!comp.m_opened)
-                continue;
+        const auto it = m_dependants.find(dep);
+        if (it == m_dependants.end())
+            continue;
+        for (const auto* comp : it->second)
+            if (comp->m_opened)
+                m_parsing_pending.emplace(comp->m_file->get_location());
+    }
 
-            if (std::ranges::find(*changed_groups, comp.m_group_id) != changed_groups->end())
+    if (changed_groups || !changed_dependencies.empty())
+    {
+        const auto changed_group = [&changed_groups](const auto& group) {
+            return changed_groups && std::ranges::find(*changed_groups, group) != changed_groups->end();
+        };
+        for (auto& [_, comp] : m_processor_files)
+        {
+            if (comp.m_opened && changed_group(comp.m_group_id))
                 m_parsing_pending.emplace(comp.m_file->get_location());
         }
+
+        std::erase_if(m_preparsed, [&changed_dependencies, &changed_group](const auto& e) {
+            return changed_dependencies.contains(e.first.member) || changed_group(e.first.group);
+        });
     }
+
     return utils::task::wait_all(std::move(pending_updates));
 }
 
@@ -830,10 +1204,27 @@ location workspace::definition(const resource_location& document_loc, position p
     if (opencodes.empty())
         return { pos, document_loc };
     // for now take last opencode
-    if (const auto* lsp_context = opencodes.back()->m_last_results->lsp_context.get())
-        return lsp_context->definition(document_loc, pos);
-    else
+    const auto* lsp_context = opencodes.back()->m_last_results->lsp_context.get();
+    if (!lsp_context)
         return { pos, document_loc };
+
+    // external symbols are defined by other programs, the EXTRN statement is used only when they are not known
+    if (const auto name = lsp_context->ordinary_symbol(document_loc, pos))
+    {
+        using enum context::section_kind;
+        if (const auto* sect = lsp_context->get_related_hlasm_context().ord_ctx.get_section(*name);
+            sect && (sect->kind == EXTERNAL || sect->kind == WEAK_EXTERNAL))
+        {
+            const auto program = opencodes.back()->m_file->get_location().get_uri();
+            for (const auto& [p, def] : m_index.definitions(name->to_string_view()))
+            {
+                if (p != program)
+                    return def;
+            }
+        }
+    }
+
+    return lsp_context->definition(document_loc, pos);
 }
 
 std::vector<location> workspace::references(const resource_location& document_loc, position pos) const
@@ -897,13 +1288,13 @@ std::vector<document_symbol_item> workspace::document_symbol(const resource_loca
         return {};
 }
 
-std::vector<token_info> workspace::semantic_tokens(const resource_location& document_loc) const
+semantic_tokens_info workspace::semantic_tokens(const resource_location& document_loc) const
 {
     auto comp = find_processor_file_impl(document_loc);
     if (!comp)
         return {};
 
-    return comp->m_last_results->hl_info;
+    return { comp->m_last_results->hl_info, comp->m_last_results->hl_info_generation };
 }
 
 std::vector<branch_info> workspace::branch_information(const resource_location& document_loc) const
@@ -933,13 +1324,14 @@ std::vector<folding_range> workspace::folding(const resource_location& document_
     return lsp::generate_folding_ranges(data);
 }
 
-std::vector<output_line> workspace::retrieve_output(const resource_location& document_loc) const
+std::pair<std::vector<output_line>, unsigned long long> workspace::retrieve_output(
+    const resource_location& document_loc, size_t first, size_t count) const
 {
     auto comp = find_processor_file_impl(document_loc);
     if (!comp)
         return {};
 
-    return comp->m_last_results->outputs;
+    return { comp->m_last_results->outputs.lines(first, count), comp->m_last_results->outputs_generation };
 }
 
 std::optional<performance_metrics> workspace::last_metrics(const resource_location& document_loc) const
@@ -1055,30 +1447,18 @@ std::vector<std::pair<std::string, size_t>> workspace::make_opcode_suggestion(
     return result;
 }
 
-template<bool Multi = false, typename T, typename U, typename Projector = std::identity>
-void erase_ordered(T& from, const U& what, Projector p = Projector())
-{
-    auto f = from.begin();
-    auto w = what.begin();
-    while (f != from.end() && w != what.end())
-    {
-        if (auto c = *f <=> std::invoke(p, *w); c == 0)
-        {
-            f = from.erase(f);
-            if constexpr (!Multi)
-                ++w;
-        }
-        else if (c < 0)
-            f = from.lower_bound(std::invoke(p, *w));
-        else
-            w = what.lower_bound(*f);
-    }
-}
-
 void workspace::filter_and_close_dependencies(
     std::set<resource_location> files_to_close_candidates, const processor_file_compoments* file_to_ignore)
 {
     // filters the files that are dependencies of other dependants and externally open files
+    std::erase_if(files_to_close_candidates, [this, file_to_ignore](const auto& dep) {
+        const auto it = m_dependants.find(dep);
+        return it != m_dependants.end()
+            && std::ranges::any_of(it->second, [file_to_ignore](const auto* c) { return c != file_to_ignore; });
+    });
+    // members prepared for other programs stay
+    for (const auto& [key, _] : m_preparsed)
+        files_to_close_candidates.erase(key.member);
     for (const auto& [_, component] : m_processor_files)
     {
         if (files_to_close_candidates.empty())
@@ -1089,27 +1469,68 @@ void workspace::filter_and_close_dependencies(
 
         if (component.m_opened)
             files_to_close_candidates.erase(component.m_file->get_location());
-
-        erase_ordered(files_to_close_candidates,
-            component.m_dependencies,
-            &decltype(component.m_dependencies)::value_type::first);
     }
 
     // close all exclusive dependencies of file
     for (const auto& dep : files_to_close_candidates)
     {
-        m_processor_files.erase(dep);
+        if (auto it = m_processor_files.find(dep); it != m_processor_files.end())
+        {
+            remove_dependant(it->second);
+            m_processor_files.erase(it);
+        }
     }
 }
 
 bool workspace::is_dependency(const resource_location& file_location) const
 {
-    for (const auto& [_, component] : m_processor_files)
+    return m_dependants.contains(file_location);
+}
+
+void workspace::add_dependant(const processor_file_compoments& comp)
+{
+    for (const auto& [dep, _] : comp.m_dependencies)
+        m_dependants[dep].push_back(&comp);
+}
+
+void workspace::remove_dependant(const processor_file_compoments& comp)
+{
+    for (const auto& [dep, _] : comp.m_dependencies)
     {
-        if (component.m_dependencies.contains(file_location))
-            return true;
+        const auto it = m_dependants.find(dep);
+        if (it == m_dependants.end())
+            continue;
+        std::erase(it->second, &comp);
+        if (it->second.empty())
+            m_dependants.erase(it);
+    }
+}
+
+void workspace::update_index(const processor_file_compoments& comp)
+{
+    std::vector<workspace_index::symbol_definition> symbols;
+    if (const auto& lsp_ctx = comp.m_last_results->lsp_context)
+    {
+        const auto& ord_ctx = lsp_ctx->get_related_hlasm_context().ord_ctx;
+        // the names are referenced, short identifiers are stored inside id_index
+        const auto add = [&symbols, &ord_ctx](const context::id_index& name) {
+            if (const auto* sym = ord_ctx.get_symbol(name))
+                symbols.push_back({ name.to_string_view(), sym->symbol_location() });
+        };
+        for (const auto& sect : ord_ctx.sections())
+        {
+            if (sect->kind == context::section_kind::EXECUTABLE || sect->kind == context::section_kind::READONLY)
+                add(sect->name);
+        }
+        // entry points naming sections were already added
+        for (const auto& name : ord_ctx.entry_points())
+        {
+            if (!ord_ctx.get_section(name))
+                add(name);
+        }
     }
-    return false;
+
+    m_index.update(comp.m_file->get_location().get_uri(), symbols);
 }
 
 utils::task workspace::processor_file_compoments::update_source_if_needed(file_manager& fm)
@@ -1119,7 +1540,10 @@ utils::task workspace::processor_file_compoments::update_source_if_needed(file_m
         return fm.add_file(m_file->get_location()).then([this](std::shared_ptr<file> f) {
             m_file = std::move(f);
             // preserve output - extra change notification event exists
-            *m_last_results = { .outputs = std::move(m_last_results->outputs) };
+            *m_last_results = {
+                .outputs = std::move(m_last_results->outputs),
+                .outputs_generation = m_last_results->outputs_generation,
+            };
         });
     }
     return {};
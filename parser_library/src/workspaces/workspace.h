@@ -16,10 +16,12 @@
 #define HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_H
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -40,6 +42,7 @@
 #include "semantics/highlighting_info.h"
 #include "utils/resource_location.h"
 #include "utils/task.h"
+#include "workspace_index.h"
 
 namespace hlasm_plugin::utils {
 struct text_convertor;
@@ -51,8 +54,12 @@ struct document_symbol_item;
 struct fade_message;
 class external_configuration_requests;
 } // namespace hlasm_plugin::parser_library
+namespace hlasm_plugin::parser_library::context {
+class id_storage;
+} // namespace hlasm_plugin::parser_library::context
 namespace hlasm_plugin::parser_library::workspaces {
 class file_manager;
+class io_worker_pool;
 class library;
 class processor_file_impl;
 using ws_uri = std::string;
@@ -67,6 +74,8 @@ struct parse_file_result
     size_t errors = 0;
     size_t warnings = 0;
     bool outputs_changed = false;
+    // the analysis stopped early on request, no results were stored
+    bool cancelled = false;
 };
 // Represents a LSP workspace. It solves all dependencies between files -
 // implements parse lib provider and decides which files are to be parsed
@@ -88,17 +97,39 @@ public:
 
     void produce_diagnostics(std::vector<diagnostic>& target) const;
 
+    // the diagnostics of a file stay the same as long as its generation does
+    struct file_diagnostics
+    {
+        const resource_location* file;
+        unsigned long long generation;
+        std::span<const diagnostic> diagnostics;
+    };
+    void produce_diagnostics(std::vector<file_diagnostics>& target) const;
+
     [[nodiscard]] utils::task mark_file_for_parsing(
         const resource_location& file_location, file_content_state file_content_status);
     void mark_all_opened_files();
     [[nodiscard]] utils::task did_open_file(
         resource_location file_location, file_content_state file_content_status = file_content_state::changed_content);
     [[nodiscard]] utils::task did_close_file(resource_location file_location);
+    // reanalyzes the opened program when its members only have the minimal lsp index
+    void request_full_lsp_details(const resource_location& file_location);
     [[nodiscard]] utils::task did_change_watched_files(std::vector<resource_location> file_locations,
         std::vector<file_content_state> file_change_status,
         std::optional<std::vector<index_t<processor_group, unsigned long long>>> changed_groups);
 
-    [[nodiscard]] utils::value_task<parse_file_result> parse_file(resource_location* selected = nullptr);
+    // files for which defer returns true remain pending
+    [[nodiscard]] utils::value_task<parse_file_result> parse_file(resource_location* selected = nullptr,
+        const std::function<bool(const resource_location&)>& defer = {});
+    // changes to the file invalidate the results of the analysis started by parse_file that has not finished yet
+    bool affects_parse_in_progress(const resource_location& file_location) const;
+    // schedules the analysis of an opened program again (e.g. after its analysis has been cancelled)
+    void requeue_file(const resource_location& file_location);
+    // opened programs that are reanalyzed when the file changes
+    std::vector<resource_location> affected_programs(const resource_location& file_location) const;
+    // parses a member that an opened program used in its previous analyses but not in the last one,
+    // returns an invalid task when there is nothing left to prepare
+    [[nodiscard]] utils::task preparse_dependencies();
 
     location definition(const resource_location& document_loc, position pos) const;
     std::vector<location> references(const resource_location& document_loc, position pos) const;
@@ -110,13 +141,16 @@ public:
         const utils::text_convertor* tc);
     std::vector<document_symbol_item> document_symbol(const resource_location& document_loc) const;
 
-    std::vector<token_info> semantic_tokens(const resource_location& document_loc) const;
+    semantic_tokens_info semantic_tokens(const resource_location& document_loc) const;
 
     std::vector<branch_info> branch_information(const resource_location& document_loc) const;
 
     std::vector<folding_range> folding(const resource_location& document_loc) const;
 
-    std::vector<output_line> retrieve_output(const resource_location& document_loc) const;
+    // at most count output lines starting with the first one
+    // the lines come with the generation of the output they were taken from
+    std::pair<std::vector<output_line>, unsigned long long> retrieve_output(
+        const resource_location& document_loc, size_t first, size_t count) const;
 
     std::optional<performance_metrics> last_metrics(const resource_location& document_loc) const;
 
@@ -132,6 +166,15 @@ public:
     std::unordered_map<utils::resource::resource_location, std::vector<utils::resource::resource_location>>
     report_used_configuration_files() const;
 
+    // programs reuse the members parsed for the programs closed before them
+    void share_member_caches();
+
+    // operands of the analyzed programs are checked also on the threads of the pool
+    void check_operands_on(io_worker_pool* pool) noexcept { m_check_pool = pool; }
+
+    workspace_index& index() noexcept { return m_index; }
+    const workspace_index& index() const noexcept { return m_index; }
+
 private:
     file_manager& file_manager_;
     file_manager_vfm fm_vfm_;
@@ -151,6 +194,48 @@ private:
 
     std::unordered_map<resource_location, processor_file_compoments> m_processor_files;
     std::unordered_set<resource_location> m_parsing_pending;
+    // reverse index of processor_file_compoments::m_dependencies
+    std::unordered_map<resource_location, std::vector<const processor_file_compoments*>> m_dependants;
+
+    void add_dependant(const processor_file_compoments& comp);
+    void remove_dependant(const processor_file_compoments& comp);
+
+    workspace_index m_index;
+
+    void update_index(const processor_file_compoments& comp);
+
+    // members parsed ahead of time while idle, macro caches are tied to the id storage of the program
+    struct preparse_key
+    {
+        resource_location member;
+        index_t<processor_group, unsigned long long> group;
+        const context::id_storage* ids;
+
+        bool operator==(const preparse_key&) const = default;
+    };
+    struct preparse_key_hash
+    {
+        size_t operator()(const preparse_key& key) const noexcept;
+    };
+    std::unordered_map<preparse_key, std::shared_ptr<dependency_cache>, preparse_key_hash> m_preparsed;
+    // id storage of all programs when the member caches are shared
+    std::shared_ptr<context::id_storage> m_shared_ids;
+
+    io_worker_pool* m_check_pool = nullptr;
+
+    static constexpr size_t max_preparse_candidates = 16;
+
+    static preparse_key preparsed_key(const resource_location& member, const processor_file_compoments& comp);
+    void update_member_history(processor_file_compoments& comp);
+    [[nodiscard]] utils::task preparse_member(
+        processor_file_compoments& comp, std::string name, resource_location url, processing::processing_kind kind);
+
+    struct parse_in_progress
+    {
+        const processor_file_compoments* comp;
+        const workspace_parse_lib_provider* libs;
+    };
+    std::optional<parse_in_progress> m_parse_in_progress;
 
     [[nodiscard]] utils::value_task<processor_file_compoments&> add_processor_file_impl(std::shared_ptr<file> f);
     const processor_file_compoments* find_processor_file_impl(const resource_location& file) const;
@@ -1224,13 +1224,16 @@ workspace_configuration::get_analyzer_configuration(utils::resource::resource_lo
     utils::to_upper(opts.sysin_member);
     opts.sysin_dsn = sysin_path.parent().get_local_path_or_uri();
 
+    const auto settings = m_local_config.fill_missing_settings(m_global_config);
+
     co_return {
         analyzer_configuration {
             .libraries = proc_grp ? proc_grp->libraries() : std::vector<std::shared_ptr<library>>(),
             .opts = std::move(opts),
             .pp_opts = proc_grp ? proc_grp->preprocessors() : std::vector<preprocessor_options>(),
             .alternative_config_url = std::move(alt_config),
-            .dig_suppress_limit = m_local_config.fill_missing_settings(m_global_config).diag_supress_limit.value(),
+            .dig_suppress_limit = settings.diag_supress_limit.value(),
+            .minimal_lsp_index = settings.minimal_lsp_index.value(),
             .external_functions = proc_grp ? proc_grp->external_functions() : external_functions_list(),
         },
         group_id,
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "workspace_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+namespace {
+// layout: magic, version, string table, program records, all numbers are 32-bit little-endian
+//  string:  length, bytes
+//  program: program, symbol count, (name, uri, line, column)*
+constexpr std::string_view magic = "HLWI";
+constexpr std::uint32_t format_version = 2;
+
+void write_u32(std::string& out, std::uint32_t v)
+{
+    for (int i = 0; i < 4; ++i, v >>= 8)
+        out.push_back(static_cast<char>(v & 0xff));
+}
+
+class reader
+{
+    std::string_view m_data;
+
+public:
+    explicit reader(std::string_view data)
+        : m_data(data)
+    {}
+
+    bool empty() const noexcept { return m_data.empty(); }
+
+    std::optional<std::uint32_t> u32()
+    {
+        if (m_data.size() < 4)
+            return std::nullopt;
+        std::uint32_t v = 0;
+        for (int i = 3; i >= 0; --i)
+            v = v << 8 | static_cast<unsigned char>(m_data[i]);
+        m_data.remove_prefix(4);
+        return v;
+    }
+
+    std::optional<std::string_view> bytes(size_t n)
+    {
+        if (m_data.size() < n)
+            return std::nullopt;
+        const auto v = m_data.substr(0, n);
+        m_data.remove_prefix(n);
+        return v;
+    }
+};
+
+std::uint32_t clamp_u32(size_t v) { return static_cast<std::uint32_t>(std::min<size_t>(v, 0xffffffffU)); }
+} // namespace
+
+workspace_index::string_id workspace_index::intern(std::string_view s)
+{
+    if (const auto it = m_string_ids.find(s); it != m_string_ids.end())
+        return it->second;
+
+    const auto id = static_cast<string_id>(m_strings.size());
+    const auto& stored = m_strings.emplace_back(s);
+    m_string_ids.try_emplace(stored, id);
+    m_references.push_back(0);
+    ++m_unreferenced;
+    return id;
+}
+
+void workspace_index::reference(string_id id)
+{
+    if (m_references[id]++ == 0)
+        --m_unreferenced;
+}
+
+void workspace_index::release(string_id id)
+{
+    if (--m_references[id] == 0)
+        ++m_unreferenced;
+}
+
+const workspace_index::string_id* workspace_index::find(std::string_view s) const
+{
+    const auto it = m_string_ids.find(s);
+    return it == m_string_ids.end() ? nullptr : &it->second;
+}
+
+void workspace_index::add_program(string_id program, program_record record)
+{
+    reference(program);
+    for (const auto& s : record.symbols)
+    {
+        reference(s.name);
+        reference(s.uri);
+        if (auto& d = m_definitions[s.name]; d.empty() || d.back() != program)
+            d.push_back(program);
+    }
+
+    m_programs.insert_or_assign(program, std::move(record));
+}
+
+void workspace_index::remove_program(string_id program)
+{
+    const auto it = m_programs.find(program);
+    if (it == m_programs.end())
+        return;
+
+    for (const auto& s : it->second.symbols)
+    {
+        if (const auto d = m_definitions.find(s.name); d != m_definitions.end())
+        {
+            std::erase(d->second, program);
+            if (d->second.empty())
+                m_definitions.erase(d);
+        }
+        release(s.name);
+        release(s.uri);
+    }
+    release(program);
+
+    m_programs.erase(it);
+}
+
+void workspace_index::compact()
+{
+    std::vector<string_id> remap(m_strings.size());
+    std::deque<std::string> strings;
+    for (string_id id = 0; id < m_strings.size(); ++id)
+    {
+        if (!m_references[id])
+            continue;
+        remap[id] = static_cast<string_id>(strings.size());
+        strings.push_back(std::move(m_strings[id]));
+    }
+
+    auto programs = std::move(m_programs);
+    clear();
+
+    m_strings = std::move(strings);
+    m_references.resize(m_strings.size());
+    m_unreferenced = m_strings.size();
+    for (string_id id = 0; id < m_strings.size(); ++id)
+        m_string_ids.try_emplace(m_strings[id], id);
+
+    for (auto& [program, record] : programs)
+    {
+        for (auto& sym : record.symbols)
+        {
+            sym.name = remap[sym.name];
+            sym.uri = remap[sym.uri];
+        }
+        add_program(remap[program], std::move(record));
+    }
+}
+
+void workspace_index::clear()
+{
+    m_strings.clear();
+    m_string_ids.clear();
+    m_references.clear();
+    m_unreferenced = 0;
+    m_programs.clear();
+    m_definitions.clear();
+}
+
+void workspace_index::update(std::string_view program, std::span<const symbol_definition> symbols)
+{
+    const auto program_id = intern(program);
+
+    program_record record;
+    record.symbols.reserve(symbols.size());
+    for (const auto& s : symbols)
+        record.symbols.push_back({
+            intern(s.name),
+            intern(s.loc.resource_loc.get_uri()),
+            clamp_u32(s.loc.pos.line),
+            clamp_u32(s.loc.pos.column),
+        });
+
+    // the order of the inputs does not matter
+    std::ranges::sort(record.symbols);
+
+    if (const auto it = m_programs.find(program_id); it != m_programs.end() && it->second == record)
+        return;
+
+    remove_program(program_id);
+    add_program(program_id, std::move(record));
+
+    m_modified = true;
+
+    if (m_unreferenced > m_strings.size() / 2)
+        compact();
+}
+
+void workspace_index::remove(std::string_view uri)
+{
+    const auto in_scope = [uri](std::string_view program) {
+        if (!program.starts_with(uri))
+            return false;
+        program.remove_prefix(uri.size());
+        return program.empty() || uri.ends_with('/') || program.starts_with('/');
+    };
+
+    std::vector<string_id> removed;
+    for (const auto& [program, _] : m_programs)
+    {
+        if (in_scope(m_strings[program]))
+            removed.push_back(program);
+    }
+    if (removed.empty())
+        return;
+
+    for (const auto program : removed)
+        remove_program(program);
+
+    m_modified = true;
+
+    if (m_unreferenced > m_strings.size() / 2)
+        compact();
+}
+
+std::vector<std::pair<std::string_view, location>> workspace_index::definitions(std::string_view name) const
+{
+    std::vector<std::pair<std::string_view, location>> result;
+
+    const auto* name_id = find(name);
+    if (!name_id)
+        return result;
+    const auto it = m_definitions.find(*name_id);
+    if (it == m_definitions.end())
+        return result;
+
+    for (const auto program : it->second)
+    {
+        for (const auto& s : m_programs.at(program).symbols)
+        {
+            if (s.name != *name_id)
+                continue;
+            result.emplace_back(m_strings[program],
+                location(position(s.line, s.column), utils::resource::resource_location(m_strings[s.uri])));
+        }
+    }
+
+    std::ranges::sort(result);
+
+    return result;
+}
+
+std::vector<std::string> workspace_index::programs() const
+{
+    std::vector<std::string> result;
+    result.reserve(m_programs.size());
+    for (const auto& [program, _] : m_programs)
+        result.emplace_back(m_strings[program]);
+
+    std::ranges::sort(result);
+
+    return result;
+}
+
+std::string workspace_index::serialize()
+{
+    std::vector<string_id> remap(m_strings.size(), std::numeric_limits<string_id>::max());
+    std::vector<string_id> used;
+    const auto map = [&remap, &used](string_id id) {
+        if (remap[id] == std::numeric_limits<string_id>::max())
+        {
+            remap[id] = static_cast<string_id>(used.size());
+            used.push_back(id);
+        }
+        return remap[id];
+    };
+
+    // the output does not depend on the history of the index
+    std::vector<std::pair<std::string_view, const decltype(m_programs)::value_type*>> programs;
+    programs.reserve(m_programs.size());
+    for (const auto& p : m_programs)
+        programs.emplace_back(m_strings[p.first], &p);
+    std::ranges::sort(programs, {}, [](const auto& p) { return p.first; });
+
+    std::string records;
+    for (const auto& [_, p] : programs)
+    {
+        const auto& [program, record] = *p;
+        write_u32(records, map(program));
+        write_u32(records, clamp_u32(record.symbols.size()));
+        for (const auto& s : record.symbols)
+        {
+            write_u32(records, map(s.name));
+            write_u32(records, map(s.uri));
+            write_u32(records, s.line);
+            write_u32(records, s.column);
+        }
+    }
+
+    std::string result(magic);
+    write_u32(result, format_version);
+    write_u32(result, clamp_u32(used.size()));
+    for (const auto id : used)
+    {
+        const auto& s = m_strings[id];
+        write_u32(result, clamp_u32(s.size()));
+        result.append(s);
+    }
+    write_u32(result, clamp_u32(m_programs.size()));
+    result.append(records);
+
+    m_modified = false;
+
+    return result;
+}
+
+bool workspace_index::deserialize(std::string_view data)
+{
+    clear();
+    m_modified = false;
+
+    const auto valid = [this, data]() {
+        if (!data.starts_with(magic))
+            return false;
+        reader r(data.substr(magic.size()));
+
+        if (r.u32() != format_version)
+            return false;
+
+        const auto string_count = r.u32();
+        if (!string_count)
+            return false;
+        for (std::uint32_t i = 0; i < *string_count; ++i)
+        {
+            const auto len = r.u32();
+            if (!len)
+                return false;
+            const auto s = r.bytes(*len);
+            if (!s || intern(*s) != i) // duplicates are not expected
+                return false;
+        }
+
+        const auto id = [&r, string_count]() -> std::optional<string_id> {
+            if (const auto v = r.u32(); v && *v < *string_count)
+                return v;
+            return std::nullopt;
+        };
+
+        const auto program_count = r.u32();
+        if (!program_count)
+            return false;
+        for (std::uint32_t i = 0; i < *program_count; ++i)
+        {
+            const auto program = id();
+            if (!program || m_programs.contains(*program))
+                return false;
+
+            program_record record;
+
+            const auto symbol_count = r.u32();
+            if (!symbol_count)
+                return false;
+            for (std::uint32_t j = 0; j < *symbol_count; ++j)
+            {
+                const auto name = id();
+                const auto uri = id();
+                const auto line = r.u32();
+                const auto column = r.u32();
+                if (!name || !uri || !line || !column)
+                    return false;
+                record.symbols.push_back({ *name, *uri, *line, *column });
+            }
+
+            add_program(*program, std::move(record));
+        }
+
+        return r.empty();
+    }();
+
+    if (!valid)
+        clear();
+
+    return valid;
+}
+
+} // namespace hlasm_plugin::parser_library::workspaces
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_INDEX_H
+#define HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_INDEX_H
+
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "location.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// externally visible symbols (control sections and entry points) defined by the analyzed programs
+// the last known state of every analyzed program is retained, even after it is closed,
+// so that it can be stored and loaded again in the next session
+class workspace_index
+{
+public:
+    struct symbol_definition
+    {
+        std::string_view name;
+        location loc;
+    };
+
+    // replaces everything previously known about the program, unchanged records do not modify the index
+    void update(std::string_view program, std::span<const symbol_definition> symbols);
+    // forgets the program, or all programs in the directory
+    void remove(std::string_view uri);
+
+    // definitions of the external symbol in all programs, paired with the program
+    std::vector<std::pair<std::string_view, location>> definitions(std::string_view name) const;
+    std::vector<std::string> programs() const;
+
+    size_t program_count() const noexcept { return m_programs.size(); }
+    size_t string_count() const noexcept { return m_strings.size(); }
+
+    // true when there are updates that were not serialized yet
+    bool modified() const noexcept { return m_modified; }
+
+    std::string serialize();
+    // the index is left empty when the data is not valid
+    bool deserialize(std::string_view data);
+
+private:
+    using string_id = std::uint32_t;
+
+    struct symbol_record
+    {
+        string_id name;
+        string_id uri;
+        std::uint32_t line;
+        std::uint32_t column;
+
+        auto operator<=>(const symbol_record&) const = default;
+    };
+
+    struct program_record
+    {
+        std::vector<symbol_record> symbols;
+
+        bool operator==(const program_record&) const = default;
+    };
+
+    // the table is compacted once most of the strings are no longer referenced
+    std::deque<std::string> m_strings;
+    std::unordered_map<std::string_view, string_id> m_string_ids;
+    std::vector<std::uint32_t> m_references;
+    size_t m_unreferenced = 0;
+
+    std::unordered_map<string_id, program_record> m_programs;
+    // reverse index of m_programs
+    std::unordered_map<string_id, std::vector<string_id>> m_definitions;
+
+    bool m_modified = false;
+
+    string_id intern(std::string_view s);
+    const string_id* find(std::string_view s) const;
+
+    void reference(string_id id);
+    void release(string_id id);
+
+    void add_program(string_id program, program_record record);
+    void remove_program(string_id program);
+    void compact();
+    void clear();
+};
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif
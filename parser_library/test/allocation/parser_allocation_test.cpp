@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <variant>
+
+#include "gtest/gtest.h"
+
+#include "context/hlasm_context.h"
+#include "context/id_storage.h"
+#include "lexing/string_with_newlines.h"
+#include "parsing/parser_impl.h"
+#include "semantics/collector.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::context;
+
+namespace {
+thread_local bool count_allocations = false;
+thread_local size_t allocations = 0;
+
+class allocation_counter
+{
+public:
+    allocation_counter()
+    {
+        allocations = 0;
+        count_allocations = true;
+    }
+    allocation_counter(const allocation_counter&) = delete;
+    allocation_counter& operator=(const allocation_counter&) = delete;
+    ~allocation_counter() { count_allocations = false; }
+
+    size_t count() const noexcept { return allocations; }
+};
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (count_allocations)
+        ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+struct lookahead_case
+{
+    std::string_view text;
+    // the operand text is handed over to the caller of the parser
+    size_t allowed_allocations;
+};
+
+class parser_allocations : public ::testing::TestWithParam<lookahead_case>
+{
+protected:
+    std::shared_ptr<id_storage> ids = std::make_shared<id_storage>();
+    hlasm_context ctx = hlasm_context(hlasm_plugin::utils::resource::resource_location(""), {}, ids);
+    parsing::parser_holder h = parsing::parser_holder(ctx, nullptr);
+
+    void parse(std::string_view text)
+    {
+        h.reset(lexing::u8string_view_with_newlines(text), {}, 0);
+        h.collector.prepare_for_next_statement();
+        h.look_lab_instr();
+    }
+};
+
+TEST_P(parser_allocations, lookahead_statement)
+{
+    const auto [text, allowed_allocations] = GetParam();
+
+    // the first statement interns the identifiers and sizes the buffers
+    parse(text);
+    const auto ids_after_first = ids->size();
+
+    size_t allocated = 0;
+    {
+        allocation_counter counter;
+        parse(text);
+        allocated = counter.count();
+    }
+
+    EXPECT_LE(allocated, allowed_allocations);
+    EXPECT_EQ(ids->size(), ids_after_first);
+
+    const auto& instr = h.collector.current_instruction();
+    ASSERT_EQ(instr.type, semantics::instruction_si_type::ORD);
+    EXPECT_EQ(std::get<id_index>(instr.value), ctx.find_id("INSTRUCTION_WITH_LONG_NAME"));
+}
+
+// all identifiers are too long to be stored inline
+INSTANTIATE_TEST_SUITE_P(parser_allocations,
+    parser_allocations,
+    ::testing::Values(lookahead_case { ".SEQUENCE_SYMBOL_NAME INSTRUCTION_WITH_LONG_NAME", 0 },
+        lookahead_case { "Ordinary_Label_Name INSTRUCTION_WITH_LONG_NAME", 0 },
+        lookahead_case { " INSTRUCTION_WITH_LONG_NAME OPERANDS,ARE,NOT,PARSED", 1 }));
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+#include "analyzer.h"
+#include "workspaces/io_worker_pool.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+auto analyze_with(const std::string& input, io_worker_pool* pool)
+{
+    analyzer a(input, analyzer_options { operand_check_pool { pool } });
+    a.analyze();
+
+    std::vector<std::tuple<std::string, size_t, size_t>> result;
+    for (const auto& d : a.diags())
+        result.emplace_back(d.code, d.diag_range.start.line, d.diag_range.start.column);
+    return result;
+}
+} // namespace
+
+TEST(parallel_check, same_diagnostics)
+{
+    std::string input = " USING *,12\n";
+    for (int i = 0; i < 200; ++i)
+    {
+        input.append(" BAL 2,1(1,111)\n");
+        input.append(" L 1,=F'1'\n");
+        input.append(" LA 1,X+4\n");
+        input.append(" DC A(*-X),AL(L'X)(0)\n");
+        input.append(" DC F'1',X'1G'\n");
+        input.append(" LR 0,2\n");
+        input.append(" DS 0F,C\n");
+        input.append(" AMODE 25\n");
+        input.append(" MVC 0(300,1),X\n");
+    }
+    input.append("X DS C\n");
+
+    const auto expected = analyze_with(input, nullptr);
+    ASSERT_FALSE(expected.empty());
+
+    io_worker_pool pool(3);
+    EXPECT_EQ(analyze_with(input, &pool), expected);
+    // the pool is reused by the following analyses
+    EXPECT_EQ(analyze_with(input, &pool), expected);
+}
+
+TEST(parallel_check, stops_at_unresolved_assembler_operand)
+{
+    std::string input;
+    for (int i = 0; i < 200; ++i)
+        input.append(" BAL 2,1(1,111)\n");
+    input.append(" USING UNKNOWN,12\n");
+    for (int i = 0; i < 200; ++i)
+        input.append(" BAL 2,1(1,111)\n");
+
+    const auto expected = analyze_with(input, nullptr);
+    ASSERT_FALSE(expected.empty());
+
+    io_worker_pool pool(3);
+    EXPECT_EQ(analyze_with(input, &pool), expected);
+}
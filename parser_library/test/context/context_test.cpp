@@ -18,12 +18,14 @@
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
+#include "../mock_parse_lib_provider.h"
 #include "analyzer.h"
 #include "context/hlasm_context.h"
 #include "context/id_storage.h"
 #include "context/variables/set_symbol.h"
 #include "context/variables/system_variable.h"
 #include "context/well_known.h"
+#include "processing/statement_analyzers/statement_analyzer.h"
 
 // tests for hlasm_ctx class:
 // id_storage
@@ -740,3 +742,64 @@ TEST(context_system_variables, SYSVER)
     EXPECT_EQ(get_var_value<context::C_t>(a.hlasm_ctx(), "T"), "U");
     EXPECT_EQ(get_var_value<context::A_t>(a.hlasm_ctx(), "K"), 5);
 }
+
+namespace {
+struct stack_depth_checker final : processing::statement_analyzer
+{
+    analyzer& a;
+    size_t statements = 0;
+    size_t max_depth = 0;
+
+    explicit stack_depth_checker(analyzer& a)
+        : a(a)
+    {}
+
+    bool analyze(const context::hlasm_statement&,
+        processing::statement_provider_kind,
+        processing::processing_kind,
+        bool) override
+    {
+        auto& ctx = *a.context().hlasm_ctx;
+        const auto depth = ctx.processing_stack_depth();
+        EXPECT_EQ(depth, ctx.processing_stack().depth());
+        EXPECT_EQ(depth, ctx.processing_stack_details().size());
+
+        ++statements;
+        max_depth = std::max(max_depth, depth);
+
+        return false;
+    }
+
+    void analyze_aread_line(const hlasm_plugin::utils::resource::resource_location&, size_t, std::string_view) override
+    {}
+
+    void analyze_skipped_statement(const hlasm_plugin::utils::resource::resource_location&, size_t, size_t) override {}
+};
+} // namespace
+
+TEST(context, processing_stack_depth)
+{
+    std::string input = R"(
+         MACRO
+         INNER
+         COPY  MEMBER
+         MEND
+         MACRO
+         OUTER
+         INNER
+         AINSERT ' LR 1,1',BACK
+         MEND
+         COPY  MEMBER
+         OUTER
+)";
+    mock_parse_lib_provider libs { { "MEMBER", " LR 2,2" } };
+    analyzer a(input, analyzer_options { &libs });
+    stack_depth_checker checker(a);
+    a.register_stmt_analyzer(&checker);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_GT(checker.statements, 0);
+    // OUTER -> INNER -> MEMBER
+    EXPECT_EQ(checker.max_depth, 4);
+}
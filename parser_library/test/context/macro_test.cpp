@@ -12,6 +12,8 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
@@ -590,6 +592,94 @@ TEST(external_macro, deferred_macro_restart)
     EXPECT_TRUE(a.diags().empty());
 }
 
+namespace {
+struct no_lsp_details final : lsp_detail_provider
+{
+    bool full_lsp_details(const hlasm_plugin::utils::resource::resource_location&) const override { return false; }
+};
+
+const std::string captured_macro = R"(       MACRO
+         MAC   &P
+         AIF   ('&P' EQ 'BAD').BAD
+         MNOTE 'OK &P'
+         LR    1,&P
+         MEXIT
+.BAD     ANOP
+         LR    1,'
+         MEND
+)";
+} // namespace
+
+TEST(external_macro, operands_captured_without_details)
+{
+    std::string input = R"(
+         MAC   2
+)";
+    no_lsp_details details;
+    mock_parse_lib_provider lib_provider { { "MAC", captured_macro } };
+    lib_provider.lsp_details = &details;
+    analyzer a(input, analyzer_options { &lib_provider });
+    a.analyze();
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "MNOTE" }));
+
+    auto m = a.hlasm_ctx().find_macro(id_index("MAC"));
+    ASSERT_TRUE(m);
+
+    const auto& def = (*m)->cached_definition;
+    ASSERT_EQ(def.size(), (size_t)7);
+    // MNOTE and LR operands are only captured
+    EXPECT_FALSE(def[1].get_base()->access_deferred()->deferred_operands.scanned);
+    EXPECT_FALSE(def[2].get_base()->access_deferred()->deferred_operands.scanned);
+    EXPECT_FALSE(def[5].get_base()->access_deferred()->deferred_operands.scanned);
+}
+
+TEST(external_macro, operands_scanned_with_details)
+{
+    std::string input = R"(
+         MAC   2
+)";
+    mock_parse_lib_provider lib_provider { { "MAC", captured_macro } };
+    analyzer a(input, analyzer_options { &lib_provider });
+    a.analyze();
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "MNOTE" }));
+
+    auto m = a.hlasm_ctx().find_macro(id_index("MAC"));
+    ASSERT_TRUE(m);
+
+    const auto& def = (*m)->cached_definition;
+    ASSERT_EQ(def.size(), (size_t)7);
+    EXPECT_TRUE(def[1].get_base()->access_deferred()->deferred_operands.scanned);
+    EXPECT_TRUE(def[2].get_base()->access_deferred()->deferred_operands.scanned);
+    EXPECT_TRUE(def[5].get_base()->access_deferred()->deferred_operands.scanned);
+}
+
+TEST(external_macro, captured_operands_diagnostics)
+{
+    std::string input = R"(
+         MAC   2
+         MAC   BAD
+)";
+    const auto diag_codes = [&input](const lsp_detail_provider* details) {
+        mock_parse_lib_provider lib_provider { { "MAC", captured_macro } };
+        lib_provider.lsp_details = details;
+        analyzer a(input, analyzer_options { &lib_provider });
+        a.analyze();
+
+        std::vector<std::string> codes;
+        for (const auto& d : a.diags())
+            codes.push_back(d.code);
+        std::ranges::sort(codes);
+        return codes;
+    };
+
+    no_lsp_details details;
+    const auto full = diag_codes(nullptr);
+    const auto captured = diag_codes(&details);
+
+    EXPECT_EQ(full, (std::vector<std::string> { "M000", "MNOTE", "S0003" }));
+    EXPECT_EQ(full, captured);
+}
+
 TEST(variable_argument_passing, positive_sublist)
 {
     diagnostic_adder diags;
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+#include "../mock_parse_lib_provider.h"
+#include "context/hlasm_context.h"
+#include "context/statement_arena.h"
+#include "expressions/mach_expr_term.h"
+
+TEST(statement_arena, objects_outlive_arena_owner)
+{
+    auto arena = std::make_shared<context::statement_arena>();
+    std::weak_ptr<context::statement_arena> observer = arena;
+
+    auto obj = context::make_arena_shared<std::string>(arena, "long enough to not fit into the small buffer");
+    EXPECT_EQ(arena->allocations(), (size_t)1);
+
+    arena.reset();
+    EXPECT_FALSE(observer.expired());
+    EXPECT_EQ(*obj, "long enough to not fit into the small buffer");
+
+    obj.reset();
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(statement_arena, heap_fallback)
+{
+    auto obj = context::make_arena_shared<int>(nullptr, 5);
+    EXPECT_EQ(*obj, 5);
+}
+
+TEST(statement_arena, expressions_in_arena)
+{
+    context::statement_arena arena;
+
+    auto expr = context::make_arena_unique<expressions::mach_expr_constant>(&arena, 5, range());
+    EXPECT_EQ(arena.allocations(), (size_t)1);
+
+    auto heap_expr = context::make_arena_unique<expressions::mach_expr_constant>(nullptr, 6, range());
+    EXPECT_EQ(arena.allocations(), (size_t)1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(heap_expr.get()) % context::arena_allocated::heap_alignment, 0U);
+
+    EXPECT_FALSE(expr->is_similar(*heap_expr));
+}
+
+TEST(statement_arena, opencode_statements)
+{
+    std::string input = R"(
+A   DS  F
+    LR  1,1
+)";
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    // statements, operands and expression nodes
+    EXPECT_GE(a.hlasm_ctx().current_statement_arena()->allocations(), (size_t)7);
+}
+
+TEST(statement_arena, library_members_use_separate_arena)
+{
+    std::string mac = R"( MACRO
+ MAC
+ MEXIT
+)";
+    for (int i = 0; i < 100; ++i)
+        mac.append(" ANOP\n");
+    mac.append(" MEND\n");
+
+    mock_parse_lib_provider libs { { "MAC", mac } };
+    std::string input = " MAC\n";
+
+    analyzer a(input, analyzer_options { &libs });
+    const auto opencode_arena = a.hlasm_ctx().current_statement_arena();
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    ASSERT_TRUE(a.hlasm_ctx().find_macro(id_index("MAC")));
+    EXPECT_EQ(a.hlasm_ctx().current_statement_arena(), opencode_arena);
+    EXPECT_LT(opencode_arena->allocations(), (size_t)10);
+}
@@ -1005,6 +1005,110 @@ TEST(using, describe_empty)
     EXPECT_TRUE(coll.describe({}).empty());
 }
 
+TEST(using, many_nested_contexts)
+{
+    test_context c;
+
+    using_collection coll;
+    index_t<using_collection> current;
+    diagnostic_consumer_container<diagnostic> d_s;
+
+    auto sect = c.create_section("SECT");
+
+    constexpr int count = 100;
+    std::vector<id_index> labels;
+    std::vector<index_t<using_collection>> contexts;
+    for (int i = 0; i < count; ++i)
+    {
+        const auto& label = labels.emplace_back(c.label("L" + std::to_string(i)));
+        current = coll.add(current,
+            label,
+            c.create_symbol("SECT") + c.number(i),
+            nullptr,
+            args(c.number(1 + i % 12)),
+            dependency_evaluation_context(opcode_generation::current),
+            {});
+        contexts.push_back(current);
+    }
+    const auto with_ordinary = coll.add(current,
+        id_index(),
+        c.create_symbol("SECT"),
+        nullptr,
+        args(c.number(13)),
+        dependency_evaluation_context(opcode_generation::current),
+        {});
+
+    current = with_ordinary;
+    for (int i = 0; i < count; i += 2)
+        current = coll.remove(current,
+            args(c.create_symbol("L" + std::to_string(i))),
+            dependency_evaluation_context(opcode_generation::current),
+            {});
+    const auto after_drops =
+        coll.remove(current, args(c.number(13)), dependency_evaluation_context(opcode_generation::current), {});
+
+    coll.resolve_all(c.asm_ctx, d_s, library_info_transitional::empty);
+
+    EXPECT_TRUE(d_s.diags.empty());
+
+    for (int i = 0; i < count; ++i)
+    {
+        const auto reg = (using_collection::register_t)(1 + i % 12);
+        EXPECT_EQ(coll.evaluate(contexts[i], labels[i], sect, i + 10, false), evaluate_result(reg, 10));
+        EXPECT_EQ(coll.evaluate(contexts[i], labels[count - 1], sect, count + 9, false),
+            i == count - 1 ? evaluate_result(reg, 10) : evaluate_result(invalid_register, 0));
+        EXPECT_EQ(coll.evaluate(after_drops, labels[i], sect, i, false),
+            i % 2 ? evaluate_result(reg, 0) : evaluate_result(invalid_register, 0));
+    }
+    EXPECT_EQ(coll.evaluate(with_ordinary, id_index(), sect, 0, false), evaluate_result(13, 0));
+    EXPECT_EQ(coll.evaluate(after_drops, id_index(), sect, 0, false), evaluate_result(invalid_register, 0));
+
+    const auto description = coll.describe(after_drops);
+    ASSERT_EQ(description.size(), count / 2);
+    for (size_t i = 0; i < description.size(); ++i)
+        EXPECT_EQ(description[i].label, labels[2 * i + 1]);
+}
+
+TEST(using, drop_reg_many_sections)
+{
+    test_context c;
+
+    using_collection coll;
+    index_t<using_collection> current;
+    diagnostic_consumer_container<diagnostic> d_s;
+
+    constexpr int count = 20;
+    std::vector<const section*> sections;
+    for (int i = 0; i < count; ++i)
+    {
+        const auto name = "S" + std::to_string(i);
+        sections.push_back(c.create_section(name));
+        current = coll.add(current,
+            id_index(),
+            c.create_symbol(name),
+            nullptr,
+            args(c.number(1 + i % 4)),
+            dependency_evaluation_context(opcode_generation::current),
+            {});
+    }
+    const auto before_drop = current;
+    const auto after_drop =
+        coll.remove(current, args(c.number(2)), dependency_evaluation_context(opcode_generation::current), {});
+
+    coll.resolve_all(c.asm_ctx, d_s, library_info_transitional::empty);
+
+    EXPECT_TRUE(d_s.diags.empty());
+
+    for (int i = 0; i < count; ++i)
+    {
+        const auto reg = (using_collection::register_t)(1 + i % 4);
+        EXPECT_EQ(coll.evaluate(before_drop, id_index(), sections[i], 0, false), evaluate_result(reg, 0));
+        EXPECT_EQ(coll.evaluate(after_drop, id_index(), sections[i], 0, false),
+            reg == 2 ? evaluate_result(invalid_register, 0) : evaluate_result(reg, 0));
+    }
+    EXPECT_EQ(coll.describe(after_drop).size(), count - count / 4);
+}
+
 TEST(using, simple_using)
 {
     std::string input = R"(
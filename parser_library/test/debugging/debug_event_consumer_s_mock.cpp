@@ -14,6 +14,8 @@
 
 #include "debug_event_consumer_s_mock.h"
 
+#include <utility>
+
 using namespace hlasm_plugin::parser_library;
 
 void debug_event_consumer_s_mock::stopped(std::string_view reason, std::string_view details)
@@ -38,6 +40,13 @@ void debug_event_consumer_s_mock::wait_for_exited()
     stopped_ = false;
 }
 
+bool debug_event_consumer_s_mock::wait_for_stopped_or_exited()
+{
+    while (!stopped_ && !exited_)
+        d.analysis_step(nullptr);
+    return std::exchange(stopped_, false);
+}
+
 void debug_event_consumer_s_mock::exited(int exit_code)
 {
     (void)exit_code;
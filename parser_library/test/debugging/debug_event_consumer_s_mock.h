@@ -53,6 +53,9 @@ public:
 
     void wait_for_exited();
 
+    // returns false when the analysis ended instead
+    bool wait_for_stopped_or_exited();
+
     const auto& get_last_mnote() const { return last_mnote; }
     const auto& get_last_punch() const { return last_punch; }
 
@@ -1231,13 +1231,29 @@ TEST(debugger, breakpoints_set_get)
 {
     debugger d;
 
-    breakpoint bp(5);
+    breakpoint bp(5, "&A EQ 1", "%2");
 
     d.breakpoints("file", std::span(&bp, 1));
     auto bps = d.breakpoints("file");
 
     ASSERT_EQ(bps.size(), 1);
     EXPECT_EQ(bp.line, bps.begin()->line);
+    EXPECT_EQ(bp.condition, bps.begin()->condition);
+    EXPECT_EQ(bp.hit_condition, bps.begin()->hit_condition);
+
+    d.breakpoints("file", {});
+    EXPECT_TRUE(d.breakpoints("file").empty());
+}
+
+TEST(debugger, breakpoints_far_lines)
+{
+    debugger d;
+
+    const breakpoint bps[] = { breakpoint(1'000'000'000'000), breakpoint(3), breakpoint(3) };
+
+    d.breakpoints("file", bps);
+
+    EXPECT_EQ(d.breakpoints("file").size(), 3);
 }
 
 TEST(debugger, function_breakpoints)
@@ -1273,6 +1289,73 @@ TEST(debugger, function_breakpoints)
     d.disconnect();
 }
 
+namespace {
+const std::string conditional_loop = R"(
+&I  SETA 0
+.L  ANOP
+&I  SETA &I+1
+    AIF (&I LT 10).L
+)";
+
+// values of &I observed at each stop on the increment statement
+std::vector<std::string> collect_loop_stops(const breakpoint& bp)
+{
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, conditional_loop);
+
+    d.breakpoints(file_loc.get_uri(), std::span(&bp, 1));
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, false, resp);
+
+    std::vector<std::string> result;
+    while (m.wait_for_stopped_or_exited())
+    {
+        result.push_back(d.evaluate("&I").result);
+        d.continue_debug();
+    }
+
+    return result;
+}
+} // namespace
+
+TEST(debugger, conditional_breakpoint)
+{
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "&I EQ 5")), ElementsAre("5"));
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "(&I GT 7)")), ElementsAre("8", "9"));
+}
+
+TEST(debugger, conditional_breakpoint_invalid)
+{
+    EXPECT_EQ(collect_loop_stops(breakpoint(3, "&I EQ")).size(), (size_t)10);
+    EXPECT_EQ(collect_loop_stops(breakpoint(3, "&UNDEFINED EQ 1")).size(), (size_t)10);
+}
+
+TEST(debugger, hit_condition_breakpoint)
+{
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "", "3")), ElementsAre("2", "3", "4", "5", "6", "7", "8", "9"));
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "", "==3")), ElementsAre("2"));
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "", "%4")), ElementsAre("3", "7"));
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "", "< 3")), ElementsAre("0", "1"));
+    EXPECT_EQ(collect_loop_stops(breakpoint(3, "", "invalid")).size(), (size_t)10);
+}
+
+TEST(debugger, conditional_hit_condition_breakpoint)
+{
+    // hits are counted only when the condition holds
+    EXPECT_THAT(collect_loop_stops(breakpoint(3, "&I GE 4", ">2")), ElementsAre("6", "7", "8", "9"));
+}
+
 TEST(debugger, invalid_file)
 {
     file_manager_impl file_manager;
@@ -133,12 +133,14 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::DCLEN, { "&&" }, 1, false, "DCLEN_single_amp" },
         func_test_param { ca_expr_funcs::DCLEN, { "a''b" }, 3, false, "DCLEN_apo_char" },
         func_test_param { ca_expr_funcs::DCLEN, { "a''b&&c" }, 5, false, "DCLEN_apo_amp_char" },
+        func_test_param { ca_expr_funcs::DCLEN, { "'''&" }, 3, false, "DCLEN_odd_apo" },
 
         func_test_param { ca_expr_funcs::FIND, { "abcdef", "cde" }, 3, false, "FIND_basic1" },
         func_test_param { ca_expr_funcs::FIND, { "abcdef", "gde" }, 4, false, "FIND_basic2" },
         func_test_param { ca_expr_funcs::FIND, { "", "" }, 0, false, "FIND_empty" },
         func_test_param { ca_expr_funcs::FIND, { "", "a" }, 0, false, "FIND_l_empty" },
         func_test_param { ca_expr_funcs::FIND, { "a", "" }, 0, false, "FIND_r_empty" },
+        func_test_param { ca_expr_funcs::FIND, { "abcdef", "xyz" }, 0, false, "FIND_not_found" },
 
         func_test_param { ca_expr_funcs::INDEX, { "abc", "b" }, 2, false, "INDEX_found" },
         func_test_param { ca_expr_funcs::INDEX, { "abc", "ca" }, 0, false, "INDEX_not_found" },
@@ -211,6 +213,7 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::C2B, { "" }, "", false, "C2B_empty" },
         func_test_param { ca_expr_funcs::C2B, { "\0"s }, "00000000", false, "C2B_zero" },
         func_test_param { ca_expr_funcs::C2B, { "1234" }, "11110001111100101111001111110100", false, "C2B_valid" },
+        func_test_param { ca_expr_funcs::C2B, { "\xC3\xA4" }, "01000011", false, "C2B_multibyte" },
         func_test_param { ca_expr_funcs::C2B, { std::string(4000, '1') }, {}, true, "C2B_exceeds" },
 
         func_test_param { ca_expr_funcs::C2D, { "" }, "+0", false, "C2D_empty" },
@@ -222,6 +225,7 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::C2X, { "" }, "", false, "C2X_empty" },
         func_test_param { ca_expr_funcs::C2X, { "\0"s }, "00", false, "C2X_zero" },
         func_test_param { ca_expr_funcs::C2X, { "1234567R" }, "F1F2F3F4F5F6F7D9", false, "C2X_valid" },
+        func_test_param { ca_expr_funcs::C2X, { "a\xC3\xA4" }, "8143", false, "C2X_multibyte" },
         func_test_param { ca_expr_funcs::C2X, { std::string(4000, '1') }, {}, true, "C2X_exceeds" },
 
         func_test_param { ca_expr_funcs::D2B, { "" }, "", false, "D2B_empty" },
@@ -262,6 +266,7 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::DCVAL, { "&&" }, "&", false, "DCVAL_single_amp" },
         func_test_param { ca_expr_funcs::DCVAL, { "a''b" }, "a'b", false, "DCVAL_apo_char" },
         func_test_param { ca_expr_funcs::DCVAL, { "a''b&&c" }, "a'b&c", false, "DCVAL_apo_amp_char" },
+        func_test_param { ca_expr_funcs::DCVAL, { "'''&" }, "''&", false, "DCVAL_odd_apo" },
 
         func_test_param { ca_expr_funcs::DEQUOTE, { "adam" }, "adam", false, "DEQUOTE_char" },
         func_test_param { ca_expr_funcs::DEQUOTE, { "" }, "", false, "DEQUOTE_empty" },
@@ -271,6 +276,7 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::DEQUOTE, { "'" }, "", false, "DEQUOTE_apo_one_side" },
 
         func_test_param { ca_expr_funcs::DOUBLE, { "a&&''&b" }, "a&&&&''''&&b", false, "DOUBLE_simple" },
+        func_test_param { ca_expr_funcs::DOUBLE, { "abc" }, "abc", false, "DOUBLE_nothing" },
         func_test_param { ca_expr_funcs::DOUBLE, { std::string(4000, '\'') }, {}, true, "DOUBLE_exceeds" },
 
         func_test_param { ca_expr_funcs::LOWER, { "aBcDefG321&^%$" }, "abcdefg321&^%$", false, "LOWER_simple" },
@@ -292,6 +298,7 @@ INSTANTIATE_TEST_SUITE_P(func_parameters_suite,
         func_test_param { ca_expr_funcs::X2C, { "F1f2F3F4F5" }, "12345", false, "X2C_basic" },
         func_test_param { ca_expr_funcs::X2C, { "000F1" }, "\0\0"s + "1", false, "X2C_basic2" },
         func_test_param { ca_expr_funcs::X2C, { "0g1" }, {}, true, "X2C_bad_char" },
+        func_test_param { ca_expr_funcs::X2C, { "f1g" }, {}, true, "X2C_bad_second_char" },
 
         func_test_param { ca_expr_funcs::X2D, { "" }, "+0", false, "X2D_empty" },
         func_test_param { ca_expr_funcs::X2D, { "00" }, "+0", false, "X2D_zeros" },
@@ -20,6 +20,7 @@
 #include "completion_item.h"
 #include "completion_trigger_kind.h"
 #include "context/hlasm_context.h"
+#include "lsp/completion_filter.h"
 #include "lsp/item_convertors.h"
 #include "lsp/lsp_context.h"
 
@@ -37,8 +38,7 @@ TEST(lsp_completion, completion_list_instr)
 
     auto aaaa = a.context().lsp_ctx->get_macro_info(context::id_index("AAAA"));
     ASSERT_TRUE(aaaa);
-    std::unordered_map<const context::macro_definition*, lsp::macro_info_ptr> m;
-    m.try_emplace(aaaa->macro_definition.get(), aaaa);
+    std::vector<const lsp::macro_info*> m { aaaa.get() };
 
     auto result = lsp::generate_completion(lsp::completion_list_source(lsp::completion_list_instructions {
                                                "AAAAA", 1, &m, a.context().lsp_ctx.get(), { "AAAA", "ADATA" } }),
@@ -62,8 +62,7 @@ TEST(lsp_completion, completion_list_instr_exact)
 
     auto aaaa = a.context().lsp_ctx->get_macro_info(context::id_index("AAAA"));
     ASSERT_TRUE(aaaa);
-    std::unordered_map<const context::macro_definition*, lsp::macro_info_ptr> m;
-    m.try_emplace(aaaa->macro_definition.get(), aaaa);
+    std::vector<const lsp::macro_info*> m { aaaa.get() };
 
     auto result = lsp::generate_completion(lsp::completion_list_source(lsp::completion_list_instructions {
                                                "AAA", 1, &m, a.context().lsp_ctx.get(), { "AAAA", "ADATA" } }),
@@ -239,3 +238,72 @@ LABEL  DS A
     EXPECT_EQ(t1.first, t2.first);
     EXPECT_THAT(t1.second, UnorderedElementsAreArray(t2.second));
 }
+
+TEST(lsp_completion, ordinary_operands_prefix)
+{
+    using namespace ::testing;
+
+    const std::string input = R"(
+C        CSECT
+ALPHA    EQU   1
+BETA     EQU   2
+ABLE     DS    F
+         LARL  0,AL
+)";
+    analyzer a(input);
+    a.analyze();
+    auto loc = a.context().hlasm_ctx->opencode_location();
+
+    const auto* alpha = get_symbol(a.hlasm_ctx(), "ALPHA");
+    const auto* able = get_symbol(a.hlasm_ctx(), "ABLE");
+    ASSERT_TRUE(alpha && able);
+
+    auto l = a.context().lsp_ctx->completion(loc, position(5, 19), 0, completion_trigger_kind::invoked);
+
+    using T = std::pair<const macro_definition*, std::vector<std::pair<const symbol*, id_index>>>;
+    ASSERT_TRUE(std::holds_alternative<T>(l));
+
+    EXPECT_THAT(std::get<T>(l).second, UnorderedElementsAre(std::pair(alpha, id_index()), std::pair(able, id_index())));
+}
+
+TEST(lsp_completion, completion_list_instr_filtered)
+{
+    const std::string input = R"(
+    MACRO
+    LARGEMAC
+    MEND
+    MACRO
+    OTHER
+    MEND
+    L
+)";
+    analyzer a(input);
+    a.analyze();
+
+    auto result = lsp::generate_completion(a.context().lsp_ctx->completion(a.context().hlasm_ctx->opencode_location(),
+                                               position(7, 5),
+                                               0,
+                                               completion_trigger_kind::invoked),
+        nullptr);
+
+    ASSERT_FALSE(result.empty());
+    EXPECT_LE(result.size(), lsp::completion_list_limit * 2);
+    EXPECT_TRUE(std::ranges::all_of(result, [](const auto& e) { return e.label.starts_with("L"); }));
+    EXPECT_EQ(std::ranges::count(result, "LA", &completion_item::label), 1);
+    EXPECT_EQ(std::ranges::count(result, "LARGEMAC", &completion_item::label), 1);
+    EXPECT_EQ(std::ranges::count(result, "OTHER", &completion_item::label), 0);
+}
+
+TEST(lsp_completion, select_candidates)
+{
+    const std::vector<std::string_view> names { "AB", "ABC", "AXB", "AXC", "B", "BA" };
+    const auto select = [&names](std::string_view prefix, size_t limit) {
+        return lsp::select_completion_candidates(std::span(names), prefix, std::identity(), limit);
+    };
+
+    EXPECT_EQ(select("ab", 10), (std::vector<std::string_view> { "AB", "ABC", "AXB" }));
+    EXPECT_EQ(select("ab", 2), (std::vector<std::string_view> { "AB", "ABC" }));
+    EXPECT_EQ(select("b", 10), (std::vector<std::string_view> { "B", "BA" }));
+    EXPECT_EQ(select("c", 10), (std::vector<std::string_view> {}));
+    EXPECT_EQ(select("", 3), (std::vector<std::string_view> { "AB", "ABC", "AXB" }));
+}
@@ -16,9 +16,11 @@
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
+#include "../mock_parse_lib_provider.h"
 #include "analyzer_fixture.h"
 #include "document_symbol_item.h"
 #include "lsp/lsp_context.h"
+#include "lsp_detail_provider.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::lsp;
@@ -240,3 +242,28 @@ TEST(hover, using)
 
     EXPECT_THAT(a.context().lsp_ctx->hover(empty_loc, { 2, 5 }, nullptr), StartsWith("Active USINGs: **(PC)"));
 }
+
+namespace {
+struct no_lsp_details final : lsp_detail_provider
+{
+    bool full_lsp_details(const hlasm_plugin::utils::resource::resource_location&) const override { return false; }
+};
+} // namespace
+
+TEST(references, minimal_copybook_index)
+{
+    std::string input = R"( COPY COPYFILE
+ LR 1,SYM
+)";
+    const hlasm_plugin::utils::resource::resource_location copyfile_loc("COPYFILE");
+    mock_parse_lib_provider lib_provider { { "COPYFILE", "SYM EQU 1\n LR 1,SYM\n" } };
+    no_lsp_details details;
+    analyzer a(input, analyzer_options { &lib_provider, &details });
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    EXPECT_THAT(a.context().lsp_ctx->references(empty_loc, { 1, 6 }),
+        UnorderedElementsAre(
+            location({ 0, 0 }, copyfile_loc), location({ 1, 6 }, copyfile_loc), location({ 1, 6 }, empty_loc)));
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "gtest/gtest.h"
+
+#include "lsp/occurrence_index.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::lsp;
+
+TEST(occurrence_index, round_trip)
+{
+    const int dummy = 0;
+    const auto* mac = reinterpret_cast<const context::macro_definition*>(&dummy);
+    const std::vector<symbol_occurrence> occs {
+        symbol_occurrence(occurrence_kind::ORD, context::id_index("B"), range({ 4, 0 }, { 5, 3 }), false),
+        symbol_occurrence(context::id_index("MAC"), mac, range({ 1, 1 }, { 1, 4 })),
+        symbol_occurrence(occurrence_kind::VAR, context::id_index("V"), range({ 1, 10 }, { 1, 12 }), true),
+        symbol_occurrence(occurrence_kind::ORD, context::id_index("A"), range({ 0, 0 }, { 0, 1 }), false),
+    };
+
+    occurrence_index idx;
+    idx.assign(occs);
+
+    ASSERT_EQ(idx.size(), (size_t)4);
+    EXPECT_EQ(idx.lines(), (size_t)6);
+
+    EXPECT_EQ(idx.first_ending_at(0), (size_t)0);
+    EXPECT_EQ(idx.first_ending_at(1), (size_t)1);
+    EXPECT_EQ(idx.first_ending_at(2), (size_t)3);
+    EXPECT_EQ(idx.first_ending_at(5), (size_t)3);
+    EXPECT_EQ(idx.first_ending_at(6), (size_t)4);
+    EXPECT_EQ(idx.first_ending_at(100), (size_t)4);
+
+    EXPECT_EQ(idx.start_limit(0), (size_t)0);
+    EXPECT_EQ(idx.start_limit(1), (size_t)1);
+    EXPECT_EQ(idx.start_limit(2), (size_t)4);
+
+    EXPECT_EQ(idx.get(0, idx.end_line(0)), occs[3]);
+    EXPECT_EQ(idx.get(1, idx.end_line(1)), occs[1]);
+    EXPECT_EQ(idx.get(2, idx.end_line(2)), occs[2]);
+    EXPECT_EQ(idx.get(3, idx.end_line(3)), occs[0]);
+}
+
+TEST(occurrence_index, empty)
+{
+    occurrence_index idx;
+    idx.assign(std::vector<symbol_occurrence>());
+
+    EXPECT_EQ(idx.size(), (size_t)0);
+    EXPECT_EQ(idx.lines(), (size_t)0);
+    EXPECT_EQ(idx.first_ending_at(0), (size_t)0);
+}
+
+TEST(occurrence_index, find_similar_respects_scope)
+{
+    const int dummy[2] = {};
+    const auto* mac1 = reinterpret_cast<const macro_info*>(&dummy[0]);
+    const auto* mac2 = reinterpret_cast<const macro_info*>(&dummy[1]);
+    const context::id_index v("V");
+    const context::id_index a("A");
+
+    occurrence_index idx;
+    idx.assign(std::vector<scoped_occurrence> {
+        { symbol_occurrence(occurrence_kind::VAR, v, range({ 3, 1 }, { 3, 3 }), false), mac1 },
+        { symbol_occurrence(occurrence_kind::VAR, v, range({ 1, 1 }, { 1, 3 }), false), mac1 },
+        { symbol_occurrence(occurrence_kind::VAR, v, range({ 2, 1 }, { 2, 3 }), false), mac2 },
+        { symbol_occurrence(occurrence_kind::ORD, a, range({ 4, 0 }, { 4, 1 }), false), mac1 },
+        { symbol_occurrence(occurrence_kind::ORD, a, range({ 5, 0 }, { 5, 1 }), false), nullptr },
+    });
+
+    std::vector<position> result;
+    idx.find_similar(symbol_occurrence(occurrence_kind::VAR, v, range(), false), mac1, result);
+    EXPECT_EQ(result, (std::vector<position> { { 1, 1 }, { 3, 1 } }));
+
+    result.clear();
+    idx.find_similar(symbol_occurrence(occurrence_kind::VAR, v, range(), false), nullptr, result);
+    EXPECT_TRUE(result.empty());
+
+    result.clear();
+    idx.find_similar(symbol_occurrence(occurrence_kind::ORD, a, range(), false), nullptr, result);
+    EXPECT_EQ(result, (std::vector<position> { { 4, 0 }, { 5, 0 } }));
+}
@@ -158,6 +158,6 @@ TEST_F(benchmark_test, reparsed_statements)
 TEST_F(benchmark_test, lookahead_statements)
 {
     setUpAnalyzer(" AGO .HERE\n something\n something\n.HERE ANOP");
-    // 2 lines skipped by lookahead + 1 which finds the symbol
-    EXPECT_EQ(a->get_metrics().lookahead_statements, (size_t)3);
+    // statements without a label are passed over, only the one which finds the symbol is processed
+    EXPECT_EQ(a->get_metrics().lookahead_statements, (size_t)1);
 }
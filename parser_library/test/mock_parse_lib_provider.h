@@ -18,6 +18,7 @@
 #include <utility>
 
 #include "analyzer.h"
+#include "lsp_detail_provider.h"
 #include "parse_lib_provider.h"
 #include "utils/general_hashers.h"
 
@@ -48,6 +49,7 @@ class mock_parse_lib_provider : public parse_lib_provider
 public:
     std::unordered_map<std::string, std::unique_ptr<analyzer>, utils::hashers::string_hasher, std::equal_to<>>
         analyzers;
+    const lsp_detail_provider* lsp_details = nullptr;
 
     mock_parse_lib_provider() = default;
     mock_parse_lib_provider(std::initializer_list<std::pair<std::string, std::string>> entries)
@@ -74,6 +76,7 @@ public:
                 this,
                 std::move(ctx),
                 analyzer_options::dependency(library, kind),
+                lsp_details,
             });
         co_await a->co_analyze();
 
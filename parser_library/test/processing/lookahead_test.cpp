@@ -1555,3 +1555,64 @@ A        DS    F
 
     EXPECT_TRUE(a.diags().empty());
 }
+
+TEST(lookahead, unlabelled_statements_skipped)
+{
+    std::string input = R"(
+         AIF   (L'X EQ 4).OK
+         LR    1,1
+         MNOTE *,'TEXT'                                                X
+               ,CONTINUED
+&BAD     SETB  1
+.OK      ANOP
+X        DS    F
+)";
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_FALSE(a.hlasm_ctx().get_var_sym(id_index("BAD")));
+    EXPECT_EQ(a.get_metrics().lookahead_statements, (size_t)3);
+}
+
+TEST(lookahead, opsyn_alias_of_copy)
+{
+    std::string input = R"(
+CPY      OPSYN COPY
+&A       SETA  L'X
+         CPY   LIB
+)";
+    std::string LIB = R"(
+X        DS    F
+)";
+
+    mock_parse_lib_provider mock { { "LIB", LIB } };
+    analyzer a(input, analyzer_options { &mock });
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A"), 4);
+}
+
+TEST(lookahead, macro_definition_skipped)
+{
+    std::string input = R"(
+         AGO   .A
+         MACRO
+         MAC
+         LR    1,1
+.A       ANOP
+         MEND
+&BAD     SETB  1
+.A       ANOP
+&GOOD    SETB  1
+)";
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_FALSE(a.hlasm_ctx().get_var_sym(id_index("BAD")));
+    EXPECT_TRUE(a.hlasm_ctx().get_var_sym(id_index("GOOD")));
+}
@@ -53,6 +53,8 @@ struct operand_occurrence_analyzer_mock : public processing::statement_analyzer
 
     void analyze_aread_line(const hlasm_plugin::utils::resource::resource_location&, size_t, std::string_view) override
     {}
+
+    void analyze_skipped_statement(const hlasm_plugin::utils::resource::resource_location&, size_t, size_t) override {}
 };
 
 auto tie_occurrence(const lsp::symbol_occurrence& lhs)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/task.h"
+#include "workspaces/io_worker_pool.h"
+
+using namespace hlasm_plugin::parser_library::workspaces;
+using namespace hlasm_plugin::utils;
+
+TEST(io_worker_pool, synchronous)
+{
+    io_worker_pool pool(0);
+
+    const auto id = std::this_thread::get_id();
+    auto t = pool.run([id]() { return std::this_thread::get_id() == id; });
+
+    ASSERT_TRUE(t.done());
+    EXPECT_TRUE(t.value());
+}
+
+TEST(io_worker_pool, runs_concurrently)
+{
+    io_worker_pool pool(2);
+    std::atomic<int> started = 0;
+
+    // each operation waits for the other one to start
+    const auto op = [&started]() {
+        ++started;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started.load() < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        return started.load() == 2;
+    };
+
+    std::vector<task> tasks;
+    bool r1 = false;
+    bool r2 = false;
+    tasks.emplace_back(pool.run(op).then([&r1](bool r) { r1 = r; }));
+    tasks.emplace_back(pool.run(op).then([&r2](bool r) { r2 = r; }));
+
+    task::wait_all(std::move(tasks)).run();
+
+    EXPECT_TRUE(r1);
+    EXPECT_TRUE(r2);
+}
+
+TEST(io_worker_pool, concurrency_limit)
+{
+    io_worker_pool pool(2);
+    std::atomic<int> active = 0;
+    std::atomic<int> max_active = 0;
+
+    const auto op = [&active, &max_active]() {
+        const auto now_active = ++active;
+        for (auto m = max_active.load(); m < now_active && !max_active.compare_exchange_weak(m, now_active);)
+            ;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        --active;
+        return 0;
+    };
+
+    std::vector<task> tasks;
+    for (int i = 0; i < 8; ++i)
+        tasks.emplace_back(pool.run(op).then([](int) {}));
+
+    task::wait_all(std::move(tasks)).run();
+
+    EXPECT_LE(max_active.load(), 2);
+}
+
+TEST(io_worker_pool, exception)
+{
+    io_worker_pool pool(1);
+
+    auto t = pool.run([]() -> int { throw std::runtime_error("failure"); });
+
+    EXPECT_THROW(t.run(), std::runtime_error);
+}
+
+TEST(io_worker_pool, completion_notification)
+{
+    std::atomic<int> completed = 0;
+    io_worker_pool pool(1, [&completed]() { ++completed; });
+
+    pool.run([]() { return 0; }).run();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (completed.load() == 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+
+    EXPECT_EQ(completed.load(), 1);
+}
@@ -454,6 +454,6 @@ TEST(workspace, lsp_file_not_processed_yet)
     EXPECT_EQ(ws.completion(file_loc, { 0, 5 }, '\0', completion_trigger_kind::invoked, nullptr), empty_list);
 
     // Prior to parsing, it should return default values
-    EXPECT_EQ(ws.semantic_tokens(file_loc), semantics::lines_info());
+    EXPECT_TRUE(ws.semantic_tokens(file_loc).tokens.empty());
     EXPECT_EQ(ws.last_metrics(file_loc), performance_metrics());
 }
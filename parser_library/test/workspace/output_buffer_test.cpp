@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "workspaces/output_buffer.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+output_buffer generate(size_t count, size_t changed_line = (size_t)-1)
+{
+    output_buffer result;
+    for (size_t i = 0; i < count; ++i)
+        result.append(i % 3 ? -1 : (int)(i % 256), std::to_string(i) + (i == changed_line ? "X" : ""));
+    return result;
+}
+} // namespace
+
+TEST(output_buffer, empty)
+{
+    output_buffer b;
+
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.size(), 0);
+    EXPECT_TRUE(b.lines(0, 10).empty());
+    EXPECT_TRUE(b.same_content(output_buffer()));
+}
+
+TEST(output_buffer, lines)
+{
+    output_buffer b;
+    b.append(-1, "A");
+    b.append(2, "");
+    b.append(4, "CC");
+
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(b.lines(0, (size_t)-1),
+        (std::vector<output_line> {
+            { -1, "A" },
+            { 2, "" },
+            { 4, "CC" },
+        }));
+    EXPECT_EQ(b.lines(1, 1), (std::vector<output_line> { { 2, "" } }));
+    EXPECT_TRUE(b.lines(3, 1).empty());
+}
+
+TEST(output_buffer, pages_across_chunks)
+{
+    const size_t count = 3 * output_buffer::chunk_lines + 5;
+    const auto b = generate(count);
+
+    std::vector<output_line> all;
+    for (size_t first = 0; first < count; first += 1000)
+    {
+        auto page = b.lines(first, 1000);
+        EXPECT_EQ(page.size(), std::min<size_t>(1000, count - first));
+        all.insert(all.end(), page.begin(), page.end());
+    }
+
+    ASSERT_EQ(all.size(), count);
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(all[i].text, std::to_string(i));
+}
+
+TEST(output_buffer, change_detection)
+{
+    const size_t count = 2 * output_buffer::chunk_lines + 1;
+    const auto b = generate(count);
+
+    EXPECT_TRUE(b.same_content(generate(count)));
+    EXPECT_FALSE(b.same_content(generate(count - 1)));
+    EXPECT_FALSE(b.same_content(generate(count, 0)));
+    EXPECT_FALSE(b.same_content(generate(count, count - 1)));
+}
+
+TEST(output_buffer, line_boundaries_matter)
+{
+    output_buffer a;
+    a.append(-1, "AB");
+    a.append(-1, "C");
+
+    output_buffer b;
+    b.append(-1, "A");
+    b.append(-1, "BC");
+
+    output_buffer c;
+    c.append(-1, "AB");
+    c.append(0, "C");
+
+    EXPECT_FALSE(a.same_content(b));
+    EXPECT_FALSE(a.same_content(c));
+}
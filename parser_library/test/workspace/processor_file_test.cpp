@@ -12,6 +12,8 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
@@ -59,7 +61,7 @@ TEST(processor_file, parse_macro)
 
     run_if_valid(ws.did_open_file(opencode_loc, file_content_state::changed_content));
 
-    auto [url, wf_info, metrics, errors, warnings, outputs_changed] = ws.parse_file().run().value();
+    auto [url, wf_info, metrics, errors, warnings, outputs_changed, cancelled] = ws.parse_file().run().value();
     EXPECT_EQ(url, opencode_loc);
     EXPECT_TRUE(metrics);
 
@@ -80,7 +82,7 @@ TEST(processor_file, parse_macro)
         { 1, 1, 1, 4, hl_scopes::instruction },
     };
 
-    EXPECT_EQ(ws.semantic_tokens(opencode_loc), open_expected_hl);
+    EXPECT_TRUE(std::ranges::equal(ws.semantic_tokens(opencode_loc).tokens, open_expected_hl));
 
     performance_metrics expected_metrics;
     expected_metrics.lines = 6;
@@ -100,5 +102,5 @@ TEST(processor_file, parse_macro)
         { 3, 1, 3, 5, hl_scopes::instruction },
     };
 
-    EXPECT_EQ(ws.semantic_tokens(macro_loc), macro_expected_hl);
+    EXPECT_TRUE(std::ranges::equal(ws.semantic_tokens(macro_loc).tokens, macro_expected_hl));
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/resource_location.h"
+#include "workspaces/workspace_index.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+using namespace hlasm_plugin::utils::resource;
+
+namespace {
+location loc(std::string_view uri, size_t line)
+{
+    return location(position(line, 0), resource_location(std::string(uri)));
+}
+
+void fill(workspace_index& index)
+{
+    const workspace_index::symbol_definition syms_a[] = {
+        { "LABEL", loc("src/A", 1) },
+        { "DATA", loc("lib/COPY", 2) },
+    };
+    index.update("src/A", syms_a);
+
+    const workspace_index::symbol_definition syms_b[] = {
+        { "LABEL", loc("src/B", 5) },
+    };
+    index.update("src/B", syms_b);
+}
+} // namespace
+
+TEST(workspace_index, empty)
+{
+    workspace_index index;
+
+    EXPECT_EQ(index.program_count(), 0);
+    EXPECT_FALSE(index.modified());
+    EXPECT_TRUE(index.definitions("LABEL").empty());
+}
+
+TEST(workspace_index, definitions)
+{
+    workspace_index index;
+    fill(index);
+
+    EXPECT_EQ(index.program_count(), 2);
+    EXPECT_TRUE(index.modified());
+
+    const std::vector<std::pair<std::string_view, location>> expected_label {
+        { "src/A", loc("src/A", 1) },
+        { "src/B", loc("src/B", 5) },
+    };
+    const std::vector<std::pair<std::string_view, location>> expected_data {
+        { "src/A", loc("lib/COPY", 2) },
+    };
+
+    EXPECT_EQ(index.definitions("LABEL"), expected_label);
+    EXPECT_EQ(index.definitions("DATA"), expected_data);
+    EXPECT_TRUE(index.definitions("MAC").empty());
+    EXPECT_EQ(index.programs(), (std::vector<std::string> { "src/A", "src/B" }));
+}
+
+TEST(workspace_index, update_replaces_program)
+{
+    workspace_index index;
+    fill(index);
+
+    index.update("src/B", {});
+
+    EXPECT_EQ(index.program_count(), 2);
+    EXPECT_EQ(index.definitions("LABEL").size(), 1);
+}
+
+TEST(workspace_index, unchanged_update)
+{
+    workspace_index index;
+    fill(index);
+    index.serialize();
+
+    // the order of the inputs does not matter
+    const workspace_index::symbol_definition syms[] = {
+        { "DATA", loc("lib/COPY", 2) },
+        { "LABEL", loc("src/A", 1) },
+    };
+    index.update("src/A", syms);
+
+    EXPECT_FALSE(index.modified());
+
+    index.update("src/A", {});
+
+    EXPECT_TRUE(index.modified());
+}
+
+TEST(workspace_index, remove)
+{
+    workspace_index index;
+    fill(index);
+    const workspace_index::symbol_definition syms[] = {
+        { "OTHER", loc("srcx/C", 1) },
+    };
+    index.update("srcx/C", syms);
+    index.serialize();
+
+    index.remove("src/C");
+    EXPECT_FALSE(index.modified());
+    EXPECT_EQ(index.program_count(), 3);
+
+    index.remove("src/A");
+    EXPECT_TRUE(index.modified());
+    EXPECT_EQ(index.programs(), (std::vector<std::string> { "src/B", "srcx/C" }));
+    EXPECT_TRUE(index.definitions("DATA").empty());
+
+    // programs in a deleted directory
+    index.remove("src");
+    EXPECT_EQ(index.programs(), (std::vector<std::string> { "srcx/C" }));
+    EXPECT_TRUE(index.definitions("LABEL").empty());
+    EXPECT_EQ(index.definitions("OTHER").size(), 1);
+}
+
+TEST(workspace_index, strings_compacted)
+{
+    workspace_index index;
+    fill(index);
+    const auto initial = index.string_count();
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto name = "SYM" + std::to_string(i);
+        const workspace_index::symbol_definition syms[] = {
+            { name, loc("src/B", 5) },
+        };
+        index.update("src/B", syms);
+    }
+
+    // at most half of the strings are unreferenced
+    EXPECT_LE(index.string_count(), 2 * initial);
+    const std::vector<std::pair<std::string_view, location>> expected {
+        { "src/B", loc("src/B", 5) },
+    };
+    EXPECT_EQ(index.definitions("SYM99"), expected);
+    EXPECT_EQ(index.definitions("LABEL").size(), 1);
+    EXPECT_EQ(index.definitions("DATA").size(), 1);
+}
+
+TEST(workspace_index, roundtrip)
+{
+    workspace_index index;
+    fill(index);
+    // strings no longer referenced are not stored
+    const workspace_index::symbol_definition syms[] = {
+        { "LABEL", loc("src/A", 1) },
+    };
+    index.update("src/A", syms);
+
+    const auto data = index.serialize();
+    EXPECT_FALSE(index.modified());
+    EXPECT_EQ(data.find("lib/COPY"), std::string::npos);
+    EXPECT_EQ(data.find("DATA"), std::string::npos);
+
+    workspace_index loaded;
+    ASSERT_TRUE(loaded.deserialize(data));
+
+    EXPECT_FALSE(loaded.modified());
+    EXPECT_EQ(loaded.program_count(), 2);
+    EXPECT_EQ(loaded.definitions("LABEL"), index.definitions("LABEL"));
+    EXPECT_EQ(loaded.serialize(), data);
+}
+TEST(workspace_index, invalid_data)
+{
+    workspace_index index;
+    fill(index);
+    const auto data = index.serialize();
+
+    for (const auto& invalid : {
+             std::string(),
+             std::string("XXXX"),
+             data.substr(0, data.size() - 1),
+             data + '\0',
+         })
+    {
+        workspace_index loaded;
+        fill(loaded);
+
+        EXPECT_FALSE(loaded.deserialize(invalid));
+        EXPECT_EQ(loaded.program_count(), 0);
+        EXPECT_TRUE(loaded.definitions("LABEL").empty());
+    }
+}
@@ -436,6 +436,29 @@ TEST_F(workspace_test, did_close_file)
     EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
 }
 
+TEST_F(workspace_test, index_retains_closed_programs)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source1_loc));
+    run_if_valid(ws.did_open_file(source2_loc));
+    parse_all_files(ws);
+
+    auto expected = std::vector<std::string> { std::string(source1_loc.get_uri()), std::string(source2_loc.get_uri()) };
+    std::ranges::sort(expected);
+
+    EXPECT_EQ(ws.index().programs(), expected);
+    EXPECT_TRUE(ws.index().modified());
+
+    run_if_valid(ws.did_close_file(source1_loc));
+    parse_all_files(ws);
+
+    EXPECT_EQ(ws.index().programs(), expected);
+}
+
 TEST_F(workspace_test, did_close_file_without_save)
 {
     file_manager_extended file_manager;
@@ -512,6 +535,58 @@ TEST_F(workspace_test, did_change_watched_files_not_opened_file)
     EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
 }
 
+namespace {
+class file_manager_in_flight final : public file_manager_extended
+{
+public:
+    mutable size_t requested = 0;
+    mutable size_t completed = 0;
+    mutable size_t max_in_flight = 0;
+    bool members_changed = false;
+
+    hlasm_plugin::utils::value_task<std::optional<std::string>> load_text(
+        const resource_location& document_loc) const override
+    {
+        max_in_flight = std::max(max_in_flight, ++requested - completed);
+        return [](const file_manager_in_flight& self,
+                   hlasm_plugin::utils::value_task<std::optional<std::string>> text)
+                   -> hlasm_plugin::utils::value_task<std::optional<std::string>> {
+            auto result = co_await std::move(text);
+            ++self.completed;
+            if (result && self.members_changed)
+                result->append("\n");
+            co_return result;
+        }(*this, file_manager_extended::load_text(document_loc));
+    }
+};
+} // namespace
+
+TEST_F(workspace_test, remote_members_requested_together)
+{
+    file_manager_in_flight file_manager;
+    file_manager.did_close_file(cordep_macro_loc);
+    file_manager.did_close_file(dep_macro_loc);
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+    EXPECT_EQ(file_manager.max_in_flight, 1);
+
+    file_manager.members_changed = true;
+    EXPECT_EQ(
+        file_manager.update_file(cordep_macro_loc).run().value(), workspaces::file_content_state::changed_content);
+    EXPECT_EQ(file_manager.update_file(dep_macro_loc).run().value(), workspaces::file_content_state::changed_content);
+    EXPECT_EQ(file_manager.max_in_flight, 1);
+
+    run_if_valid(ws.did_change_watched_files({ cordep_macro_loc, dep_macro_loc },
+        { workspaces::file_content_state::changed_content, workspaces::file_content_state::changed_content },
+        {}));
+    parse_all_files(ws);
+    EXPECT_EQ(file_manager.max_in_flight, 2);
+}
+
 TEST_F(workspace_test, diagnostics_recollection)
 {
     file_manager_opt file_manager(file_manager_opt_variant::required);
@@ -731,3 +806,181 @@ TEST_F(workspace_test, track_nested_dependencies)
     parse_all_files(ws);
     EXPECT_TRUE(matches_message_codes(extract_diags(ws, ws_cfg), { "MNOTE" }));
 }
+
+TEST_F(workspace_test, minimal_lsp_info_for_closed_members)
+{
+    file_manager_extended file_manager;
+    file_manager.did_close_file(correct_macro_loc);
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    // the definition is part of the minimal index
+    EXPECT_EQ(ws.definition(source3_loc, position(0, 2)), location(position(1, 1), correct_macro_loc));
+    // occurrences inside the member are not collected
+    EXPECT_EQ(ws.hover(correct_macro_loc, position(2, 2), nullptr), "");
+
+    file_manager.did_open_file(correct_macro_loc, 2, correct_macro_file);
+    run_if_valid(ws.did_open_file(correct_macro_loc, file_content_state::changed_lsp));
+    parse_all_files(ws);
+
+    EXPECT_NE(ws.hover(correct_macro_loc, position(2, 2), nullptr), "");
+}
+
+TEST_F(workspace_test, full_lsp_info_on_request)
+{
+    file_manager_extended file_manager;
+    file_manager.did_close_file(correct_macro_loc);
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    EXPECT_EQ(ws.hover(correct_macro_loc, position(2, 2), nullptr), "");
+
+    ws.request_full_lsp_details(source3_loc);
+    parse_all_files(ws);
+
+    EXPECT_NE(ws.hover(correct_macro_loc, position(2, 2), nullptr), "");
+}
+
+TEST_F(workspace_test, minimal_lsp_info_disabled)
+{
+    file_manager_extended file_manager;
+    file_manager.did_close_file(correct_macro_loc);
+    config.minimal_lsp_index = false;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    EXPECT_NE(ws.hover(correct_macro_loc, position(2, 2), nullptr), "");
+}
+
+TEST_F(workspace_test, definition_from_other_program)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+
+    std::vector<document_change> source4_changes { document_change("OTHER CSECT\nLOCAL DS F\n ENTRY ENT\nENT DS F") };
+    file_manager.did_change_file(source4_loc, 2, source4_changes);
+    std::vector<document_change> source3_changes { document_change(" EXTRN OTHER,ENT\n DC A(OTHER,ENT,LOCAL)") };
+    file_manager.did_change_file(source3_loc, 2, source3_changes);
+
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+    run_if_valid(ws.did_close_file(source4_loc));
+    parse_all_files(ws);
+
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    // external symbols are only known from the index
+    EXPECT_EQ(ws.definition(source3_loc, position(1, 6)), location(position(0, 0), source4_loc));
+    EXPECT_EQ(ws.definition(source3_loc, position(1, 12)), location(position(3, 0), source4_loc));
+    // ordinary symbols of other programs are not visible
+    EXPECT_EQ(ws.definition(source3_loc, position(1, 16)), location(position(1, 16), source3_loc));
+    // local definitions are preferred
+    EXPECT_EQ(ws.definition(source4_loc, position(0, 0)), location(position(0, 0), source4_loc));
+}
+
+TEST_F(workspace_test, shared_member_caches)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws.share_member_caches();
+
+    ws_cfg.parse_configuration_file().run();
+
+    std::vector<document_change> changes { document_change(source_using_macro_with_dep) };
+    file_manager.did_change_file(source3_loc, 2, changes);
+
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+    run_if_valid(ws.did_close_file(source4_loc));
+    parse_all_files(ws);
+
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    EXPECT_TRUE(matches_message_codes(extract_diags(ws, ws_cfg), { "MNOTE" }));
+
+    // the macro parsed for the first program is reused
+    const auto metrics = ws.last_metrics(source3_loc);
+    ASSERT_TRUE(metrics.has_value());
+    EXPECT_EQ(metrics->macro_def_statements, (size_t)0);
+    EXPECT_EQ(metrics->copy_def_statements, (size_t)0);
+}
+
+TEST_F(workspace_test, preparse_dependencies)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+
+    // everything the program used is already cached
+    EXPECT_FALSE(ws.preparse_dependencies().valid());
+
+    auto replace_macro = [&file_manager, &ws, version = 1](std::string_view from, std::string to) mutable {
+        std::vector<document_change> changes;
+        changes.push_back(document_change({ { 0, 1 }, { 0, 1 + from.size() } }, to));
+        file_manager.did_change_file(source4_loc, ++version, changes);
+        run_if_valid(ws.mark_file_for_parsing(source4_loc, file_content_state::changed_content));
+        parse_all_files(ws);
+    };
+
+    // CORDEP (with DEP) is no longer used, but it is in the history of the program
+    replace_macro("CORDEP", "CORRECT");
+
+    size_t preparsed = 0;
+    for (auto t = ws.preparse_dependencies(); t.valid(); t = ws.preparse_dependencies())
+    {
+        t.run();
+        ++preparsed;
+    }
+    EXPECT_GE(preparsed, (size_t)1);
+    EXPECT_LE(preparsed, (size_t)2);
+
+    replace_macro("CORRECT", "CORDEP");
+
+    // the macro definition is loaded from the cache
+    const auto metrics = ws.last_metrics(source4_loc);
+    ASSERT_TRUE(metrics.has_value());
+    EXPECT_EQ(metrics->macro_def_statements, (size_t)0);
+
+    // CORRECT is prepared next
+    auto t = ws.preparse_dependencies();
+    ASSERT_TRUE(t.valid());
+    t.run();
+    EXPECT_FALSE(ws.preparse_dependencies().valid());
+}
+
+TEST_F(workspace_test, preparse_dependencies_not_used_by_history)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+
+    // members used only by the other program are not prepared
+    EXPECT_FALSE(ws.preparse_dependencies().valid());
+}
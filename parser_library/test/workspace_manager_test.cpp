@@ -12,6 +12,8 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <set>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -22,6 +24,7 @@
 #include "nlohmann/json.hpp"
 #include "utils/platform.h"
 #include "workspace/consume_diagnostics_mock.h"
+#include "workspaces/workspace_index.h"
 #include "workspace_manager.h"
 #include "workspace_manager_external_file_requests.h"
 #include "workspace_manager_response.h"
@@ -103,6 +106,249 @@ TEST(workspace_manager, did_change_file)
     EXPECT_FALSE(consumer.diags.empty());
 }
 
+TEST(workspace_manager, diagnostics_of_unchanged_files_kept)
+{
+    auto ws_mngr = create_workspace_manager();
+    diag_consumer_mock consumer;
+    ws_mngr->register_diagnostics_consumer(&consumer);
+
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+    ws_mngr->did_open_file("test/library/test_wks/file_a", 1, " ERROR_A");
+    ws_mngr->did_open_file("test/library/test_wks/file_b", 1, " ERROR_B");
+    ws_mngr->idle_handler();
+
+    const auto files = [&consumer]() {
+        std::multiset<std::string> result;
+        for (const auto& d : consumer.diags)
+            result.insert(d.file_uri);
+        return result;
+    };
+
+    EXPECT_THAT(files(), ElementsAre("test/library/test_wks/file_a", "test/library/test_wks/file_b"));
+
+    const std::vector<document_change> changes { document_change({ { 0, 0 }, { 0, 8 } }, " LR 1,1") };
+    ws_mngr->did_change_file("test/library/test_wks/file_b", 2, changes);
+    ws_mngr->idle_handler();
+
+    EXPECT_THAT(files(), ElementsAre("test/library/test_wks/file_a"));
+    EXPECT_TRUE(matches_message_codes(consumer.diags, { "SUP" }));
+
+    ws_mngr->did_close_file("test/library/test_wks/file_a");
+    ws_mngr->idle_handler();
+
+    EXPECT_TRUE(consumer.diags.empty());
+}
+
+struct parsing_metadata_consumer_mock : parsing_metadata_consumer
+{
+    std::vector<std::pair<std::string, size_t>> cancelled_analyses;
+
+    void consume_parsing_metadata(std::string_view uri, double, const parsing_metadata& metadata) override
+    {
+        cancelled_analyses.emplace_back(uri, metadata.cancelled_analyses);
+    }
+    void outputs_changed(std::string_view) override {}
+};
+
+TEST(workspace_manager, cancel_superseded_analysis)
+{
+    auto ws_mngr = create_workspace_manager();
+    diag_consumer_mock consumer;
+    parsing_metadata_consumer_mock metadata_consumer;
+    ws_mngr->register_diagnostics_consumer(&consumer);
+    ws_mngr->register_parsing_metadata_consumer(&metadata_consumer);
+
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+
+    std::string input;
+    for (int i = 0; i < 100; ++i)
+        input.append(" LR 1,1\n");
+    ws_mngr->did_open_file("test/library/test_wks/file_a", 1, input);
+    ws_mngr->did_open_file("test/library/test_wks/file_b", 1, input);
+    ws_mngr->idle_handler();
+
+    metadata_consumer.cancelled_analyses.clear();
+
+    const std::atomic<unsigned char> yield_indicator = 1;
+    const std::vector<document_change> changes { document_change({ { 0, 0 }, { 0, 0 } }, "*") };
+
+    // the analysis of file_a is interrupted
+    ws_mngr->did_change_file("test/library/test_wks/file_a", 2, changes);
+    ws_mngr->idle_handler(&yield_indicator);
+
+    // unrelated changes do not affect it
+    ws_mngr->did_change_file("test/library/test_wks/file_b", 2, changes);
+    ws_mngr->idle_handler(&yield_indicator);
+    ws_mngr->did_close_file("test/library/test_wks/file_b");
+    ws_mngr->idle_handler(&yield_indicator);
+
+    // a new version of the file supersedes it
+    ws_mngr->did_change_file("test/library/test_wks/file_a", 3, changes);
+    ws_mngr->idle_handler(&yield_indicator);
+
+    ws_mngr->idle_handler();
+
+    EXPECT_THAT(metadata_consumer.cancelled_analyses,
+        ElementsAre(std::pair<std::string, size_t>("test/library/test_wks/file_a", 1)));
+
+    ws_mngr->unregister_parsing_metadata_consumer(&metadata_consumer);
+}
+
+struct idle_handler_wakeup_mock : idle_handler_wakeup
+{
+    MOCK_METHOD(void, wake_up, (), (override));
+    MOCK_METHOD(void, wake_up_after, (std::chrono::milliseconds delay), (override));
+};
+
+TEST(workspace_manager, coalesce_edits)
+{
+    NiceMock<idle_handler_wakeup_mock> wakeup;
+    diag_consumer_mock consumer;
+
+    auto ws_mngr = create_workspace_manager({
+        .wakeup = &wakeup,
+        .min_reparse_delay = std::chrono::hours(1),
+        .max_reparse_delay = std::chrono::hours(1),
+    });
+    ws_mngr->register_diagnostics_consumer(&consumer);
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+
+    const std::string_view uri = "test/library/test_wks/new_file";
+    ws_mngr->did_open_file(uri, 1, " LR 1,1");
+    ws_mngr->idle_handler();
+
+    EXPECT_TRUE(consumer.diags.empty());
+
+    // the reparse waits for the typing to pause
+    EXPECT_CALL(wakeup, wake_up_after(Gt(std::chrono::milliseconds(0))));
+
+    const std::vector<document_change> changes { document_change({ { 0, 1 }, { 0, 3 } }, "XYZ") };
+    ws_mngr->did_change_file(uri, 2, changes);
+    ws_mngr->idle_handler();
+
+    EXPECT_TRUE(consumer.diags.empty());
+
+    // unless its results are requested
+    auto [resp, mock] = make_workspace_manager_response(
+        std::in_place_type<workspace_manager_response_mock<std::span<const folding_range>>>);
+    EXPECT_CALL(*mock, provide);
+
+    ws_mngr->folding(uri, resp);
+    ws_mngr->idle_handler();
+
+    EXPECT_TRUE(matches_message_codes(consumer.diags, { "SUP" })); // no configuration for the file
+}
+
+TEST(workspace_manager, coalesce_edits_per_file)
+{
+    NiceMock<idle_handler_wakeup_mock> wakeup;
+    diag_consumer_mock consumer;
+
+    auto ws_mngr = create_workspace_manager({
+        .wakeup = &wakeup,
+        .min_reparse_delay = std::chrono::hours(1),
+        .max_reparse_delay = std::chrono::hours(1),
+    });
+    ws_mngr->register_diagnostics_consumer(&consumer);
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+
+    const std::string_view uri_a = "test/library/test_wks/new_file_a";
+    const std::string_view uri_b = "test/library/test_wks/new_file_b";
+    ws_mngr->did_open_file(uri_a, 1, " LR 1,1");
+    ws_mngr->idle_handler();
+
+    const std::vector<document_change> changes { document_change({ { 0, 1 }, { 0, 3 } }, "XYZ") };
+    ws_mngr->did_change_file(uri_a, 2, changes);
+    ws_mngr->did_open_file(uri_b, 1, " XYZ 1,1");
+    ws_mngr->idle_handler();
+
+    // the edit of the first file does not delay the analysis of the second one
+    EXPECT_TRUE(std::ranges::any_of(consumer.diags, [uri_b](const auto& d) { return d.file_uri == uri_b; }));
+    EXPECT_TRUE(std::ranges::none_of(consumer.diags, [uri_a](const auto& d) { return d.file_uri == uri_a; }));
+}
+
+struct workspace_index_storage_mock : workspace_index_storage
+{
+    MOCK_METHOD(std::optional<std::string>, load, (), (override));
+    MOCK_METHOD(void, store, (std::string_view data), (override));
+};
+
+TEST(workspace_manager, throttled_index_store)
+{
+    NiceMock<idle_handler_wakeup_mock> wakeup;
+    NiceMock<workspace_index_storage_mock> storage;
+
+    auto ws_mngr = create_workspace_manager({
+        .wakeup = &wakeup,
+        .index_storage = &storage,
+        .index_store_interval = std::chrono::hours(1),
+    });
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+
+    const std::string_view uri = "test/library/test_wks/new_file";
+
+    EXPECT_CALL(storage, store).Times(1);
+    ws_mngr->did_open_file(uri, 1, "A CSECT");
+    ws_mngr->idle_handler();
+    Mock::VerifyAndClearExpectations(&storage);
+
+    // the change is stored later
+    EXPECT_CALL(storage, store).Times(0);
+    EXPECT_CALL(wakeup, wake_up_after(Gt(std::chrono::milliseconds(0)))).Times(AtLeast(1));
+    const std::vector<document_change> changes { document_change({ { 0, 0 }, { 0, 1 } }, "B") };
+    ws_mngr->did_change_file(uri, 2, changes);
+    ws_mngr->idle_handler();
+    Mock::VerifyAndClearExpectations(&storage);
+    Mock::VerifyAndClearExpectations(&wakeup);
+
+    // the pending changes are stored before the workspace manager goes away
+    std::string data;
+    EXPECT_CALL(storage, store).WillOnce(Invoke([&data](std::string_view d) { data = d; }));
+    ws_mngr.reset();
+
+    workspaces::workspace_index index;
+    ASSERT_TRUE(index.deserialize(data));
+    EXPECT_TRUE(index.definitions("A").empty());
+    EXPECT_EQ(index.definitions("B").size(), 1);
+}
+
+TEST(workspace_manager, index_forgets_deleted_programs)
+{
+    NiceMock<workspace_index_storage_mock> storage;
+
+    // program deleted while the server was not running
+    const std::string_view gone = "test/library/nonexistent/GONE";
+    workspaces::workspace_index previous;
+    const workspaces::workspace_index::symbol_definition syms[] = {
+        { "GONE", location(position(), hlasm_plugin::utils::resource::resource_location(gone)) },
+    };
+    previous.update(gone, syms);
+    ON_CALL(storage, load).WillByDefault(Return(previous.serialize()));
+
+    std::string data;
+    ON_CALL(storage, store).WillByDefault(Invoke([&data](std::string_view d) { data = d; }));
+
+    auto ws_mngr = create_workspace_manager({ .index_storage = &storage });
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+
+    const std::string_view uri = "test/library/test_wks/new_file";
+    ws_mngr->did_open_file(uri, 1, "A CSECT");
+    ws_mngr->idle_handler();
+
+    workspaces::workspace_index index;
+    ASSERT_TRUE(index.deserialize(data));
+    EXPECT_TRUE(index.definitions("GONE").empty());
+    EXPECT_EQ(index.definitions("A").size(), 1);
+
+    const fs_change changes[] = { { uri, fs_change_type::deleted } };
+    ws_mngr->did_change_watched_files(changes);
+    ws_mngr->idle_handler();
+    ws_mngr.reset();
+
+    ASSERT_TRUE(index.deserialize(data));
+    EXPECT_EQ(index.program_count(), 0);
+}
+
 struct workspace_manager_external_file_requests_mock : public workspace_manager_external_file_requests
 {
     MOCK_METHOD(void, read_external_file, (std::string_view url, workspace_manager_response<std::string_view> content));
@@ -210,3 +456,75 @@ TEST(workspace_manager, implicit_configuration_base_changed)
 
     EXPECT_TRUE(matches_message_text(diags.diags, { "Hello" }));
 }
+
+TEST(workspace_manager, operands_checked_on_pool)
+{
+    std::string input;
+    for (int i = 0; i < 300; ++i)
+        input.append(i % 60 ? " LR 0,2\n" : " DC X'1G'\n");
+
+    const auto analyze = [&input](unsigned check_concurrency) {
+        NiceMock<workspace_manager_external_file_requests_mock> ext_mock;
+        diag_consumer_mock consumer;
+
+        auto ws_mngr = create_workspace_manager({
+            .external_requests = &ext_mock,
+            .vscode_extensions = true,
+            .check_concurrency = check_concurrency,
+        });
+        ws_mngr->register_diagnostics_consumer(&consumer);
+        ws_mngr->add_workspace("dir", "test:/dir");
+        ws_mngr->configuration_changed({},
+            R"({"hlasm":{"proc_grps":{"pgroups":[{"name":"P1","libs":[]}]},"pgm_conf":{"pgms":[{"program":"**","pgroup":"P1"}]}}})");
+
+        EXPECT_CALL(ext_mock, read_external_file).WillRepeatedly(Invoke([](auto, auto r) { r.error(-1, ""); }));
+
+        ws_mngr->did_open_file("test:/dir/file", 1, input);
+        ws_mngr->idle_handler();
+
+        std::vector<std::pair<std::string, size_t>> result;
+        for (const auto& d : consumer.diags)
+            result.emplace_back(d.code, d.diag_range.start.line);
+        return result;
+    };
+
+    const auto expected = analyze(0);
+    EXPECT_EQ(expected.size(), 5);
+    EXPECT_EQ(analyze(2), expected);
+}
+
+TEST(workspace_manager, watched_files_batched)
+{
+    NiceMock<workspace_manager_external_file_requests_mock> ext_mock;
+    diag_consumer_mock diags;
+
+    auto ws_mngr = create_workspace_manager({ .external_requests = &ext_mock, .vscode_extensions = true });
+    ws_mngr->register_diagnostics_consumer(&diags);
+    ws_mngr->add_workspace("dir", "test:/dir");
+    ws_mngr->configuration_changed({},
+        R"({"hlasm":{"proc_grps":{"pgroups":[{"name":"P1","libs":["test:/dir/macs/"]}]},"pgm_conf":{"pgms":[{"program":"**","pgroup":"P1"}]}}})");
+
+    EXPECT_CALL(ext_mock, read_external_file).WillRepeatedly(Invoke([](auto, auto r) { r.error(-1, ""); }));
+    // the initial listing and a single refresh
+    EXPECT_CALL(ext_mock, read_external_directory(StrEq("test:/dir/macs/"), _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke([](auto, auto r, auto) {
+            static constexpr std::string_view resp[] = { "test:/dir/macs/MAC" };
+            r.provide(workspace_manager_external_directory_result { .member_urls = resp });
+        }));
+
+    ws_mngr->did_open_file("test:/dir/macs/MAC", 1, R"( MACRO
+    MAC
+    MNOTE 'Hello'
+    MEND
+)");
+    ws_mngr->did_open_file("untitled:file1", 1, " MAC");
+    ws_mngr->idle_handler();
+
+    const fs_change changes[] = { { "test:/dir/macs/MAC", fs_change_type::changed } };
+    ws_mngr->did_change_watched_files(changes);
+    ws_mngr->did_change_watched_files(changes);
+    ws_mngr->idle_handler();
+
+    EXPECT_TRUE(matches_message_text(diags.diags, { "Hello" }));
+}
@@ -32,6 +32,8 @@ template<std::move_constructible T>
 class value_task;
 struct yield_request_t
 {};
+struct cancellation_query_t
+{};
 
 class task_base
 {
@@ -76,6 +78,7 @@ protected:
         std::coroutine_handle<promise_type_base> to_resume = {};
         std::exception_ptr pending_exception;
         const std::atomic<unsigned char>* yield_indicator = nullptr;
+        bool cancellation_requested = false;
 
         template<typename T>
         T&& await_transform(T&& t) const noexcept
@@ -139,6 +142,18 @@ protected:
             };
             return yield_awaiter { top_waiter.promise().yield_indicator };
         }
+        auto await_transform(cancellation_query_t) const noexcept
+        {
+            struct cancellation_awaiter
+            {
+                bool cancelled;
+
+                constexpr bool await_ready() const noexcept { return true; }
+                constexpr void await_suspend(std::coroutine_handle<>) const noexcept {}
+                constexpr bool await_resume() const noexcept { return cancelled; }
+            };
+            return cancellation_awaiter { top_waiter.promise().cancellation_requested };
+        }
         awaiter<void> await_transform(task t) const noexcept;
         template<std::move_constructible T>
         awaiter<T> await_transform(value_task<T> t) const noexcept;
@@ -192,6 +207,13 @@ public:
 
     bool valid() const noexcept { return !!m_handle; }
 
+    // the task is expected to finish early at the next point where it checks for the cancellation
+    void request_cancellation() const noexcept
+    {
+        assert(m_handle);
+        m_handle.promise().cancellation_requested = true;
+    }
+
     void run() const
     {
         assert(m_handle);
@@ -233,8 +255,11 @@ public:
 
     static constexpr std::suspend_always suspend() { return {}; }
     static constexpr yield_request_t yield() { return {}; }
+    // co_await returns whether the outermost task has been asked to stop
+    static constexpr cancellation_query_t cancelled() { return {}; }
 
     using task_base::done;
+    using task_base::request_cancellation;
     using task_base::resume;
     using task_base::valid;
 
@@ -312,6 +337,7 @@ public:
     {}
 
     using task_base::done;
+    using task_base::request_cancellation;
     using task_base::resume;
     using task_base::valid;
 
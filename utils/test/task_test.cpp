@@ -411,3 +411,31 @@ TEST(task, yield)
     EXPECT_EQ(state, 8);
     EXPECT_FALSE(t.done());
 }
+
+TEST(task, cancellation)
+{
+    int state = 0;
+
+    auto inner = [](int& s) -> task {
+        while (!co_await task::cancelled())
+        {
+            ++s;
+            co_await task::suspend();
+        }
+    };
+    auto t = [](int& s, auto inner) -> value_task<int> {
+        co_await inner(s);
+        co_return co_await task::cancelled() ? -s : s;
+    }(state, inner);
+
+    t.resume(nullptr);
+    t.resume(nullptr);
+    EXPECT_EQ(state, 2);
+    EXPECT_FALSE(t.done());
+
+    t.request_cancellation();
+
+    t.resume(nullptr);
+    ASSERT_TRUE(t.done());
+    EXPECT_EQ(t.value(), -2);
+}